@@ -0,0 +1,188 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_ACTOR_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_ACTOR_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Actor Mailbox Runtime
+// ----------------------------------------
+// Lightweight actors with an MPSC linked mailbox (`alinked_mpsc.h`) scheduled
+// on the elastic executor (`alinked_executor.h`). Sending to an idle actor
+// schedules it exactly once; a worker then drains at most `batch` messages
+// before handing the core to the next actor. Nothing ever scans mailboxes.
+//
+// API Usage:
+// ----------------------------------------
+//   alinked_actor_runtime_t rt;
+//   alinked_actor_runtime_init(&rt, &executor_config, 32); // 32 msgs per turn
+//
+//   alinked_actor_t counter;
+//   alinked_actor_init(&counter, &rt, on_message, &state, 64);
+//   alinked_actor_send(&counter, msg);  // any thread
+//
+//   alinked_actor_runtime_destroy(&rt); // drains, then joins the workers
+//   alinked_actor_destroy(&counter);
+//
+// Internals:
+//   - `scheduled` is set by the sender that finds it clear and cleared by the
+//     worker once the mailbox looks empty; the worker re-checks afterwards so
+//     a message racing with the clear is never stranded.
+//
+// Notes:
+//   - send returns false when the message could not be queued, or when it was
+//     queued but the actor could not be scheduled; such a message runs on
+//     the next send that schedules the actor.
+//   - Each mailbox carries a striped push counter; build with
+//     ALINKED_MPSC_COMPACT when keeping very many actors around.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <stdatomic.h>
+#include "alinked_executor.h"
+#include "alinked_mpsc.h"
+#include "alinked_queue.h"
+
+DEFINE_ALINKED_NODE(void *, actor_msg);
+DEFINE_ALINKED_MPSC(void *, actor_msg);
+
+typedef struct alinked_actor_t alinked_actor_t;
+typedef void (*alinked_actor_fn)(alinked_actor_t *actor, void *msg);
+
+typedef struct
+{
+    alinked_executor_t executor;
+    size_t batch;
+} alinked_actor_runtime_t;
+
+struct alinked_actor_t
+{
+    alinked_mpsc_actor_msg_t mailbox;
+    atomic_bool scheduled;
+    alinked_actor_fn behavior;
+    void *state;
+    alinked_actor_runtime_t *runtime;
+};
+
+static inline bool alinked_actor_runtime_init(
+    alinked_actor_runtime_t *runtime,
+    const alinked_executor_config_t *config,
+    const size_t batch
+)
+{
+    runtime->batch = batch ? batch : 1;
+    return alinked_executor_init(&runtime->executor, config);
+}
+
+static inline void alinked_actor_runtime_destroy(alinked_actor_runtime_t *runtime)
+{
+    alinked_executor_destroy(&runtime->executor);
+}
+
+static inline void alinked_actor_init(
+    alinked_actor_t *actor,
+    alinked_actor_runtime_t *runtime,
+    const alinked_actor_fn behavior,
+    void *state,
+    const size_t arena_len
+)
+{
+    alinked_mpsc_actor_msg_init(&actor->mailbox, arena_len);
+    atomic_init(&actor->scheduled, false);
+    actor->behavior = behavior;
+    actor->state = state;
+    actor->runtime = runtime;
+}
+
+static inline void alinked_actor_destroy(alinked_actor_t *actor)
+{
+    alinked_mpsc_actor_msg_destroy(&actor->mailbox);
+}
+
+static inline void __fluent_libc_actor_run(void *arg);
+
+static inline bool __fluent_libc_actor_schedule(alinked_actor_t *actor)
+{
+    // a plain load first keeps hot senders from bouncing the line on exchange
+    if (atomic_load(&actor->scheduled) || atomic_exchange(&actor->scheduled, true))
+    {
+        return true;
+    }
+
+    if (!alinked_executor_submit(&actor->runtime->executor, __fluent_libc_actor_run, actor))
+    {
+        atomic_store(&actor->scheduled, false);
+        return false;
+    }
+
+    return true;
+}
+
+static inline void __fluent_libc_actor_run(void *arg)
+{
+    alinked_actor_t *actor = (alinked_actor_t *)arg;
+    void *msg;
+
+    for (;;)
+    {
+        for (size_t i = 0; i < actor->runtime->batch; i++)
+        {
+            if (!alinked_mpsc_actor_msg_try_pop(&actor->mailbox, &msg))
+            {
+                break;
+            }
+
+            actor->behavior(actor, msg);
+        }
+
+        if (alinked_mpsc_actor_msg_is_empty(&actor->mailbox))
+        {
+            break;
+        }
+
+        // still owned by us: go to the back of the run queue, or keep the
+        // core for another turn when the run queue cannot take the task
+        if (alinked_executor_submit(&actor->runtime->executor, __fluent_libc_actor_run, actor))
+        {
+            return;
+        }
+    }
+
+    atomic_store(&actor->scheduled, false);
+    if (!alinked_mpsc_actor_msg_is_empty(&actor->mailbox))
+    {
+        __fluent_libc_actor_schedule(actor);
+    }
+}
+
+static inline bool alinked_actor_send(alinked_actor_t *actor, void *msg)
+{
+    if (!alinked_mpsc_actor_msg_push(&actor->mailbox, msg))
+    {
+        return false;
+    }
+
+    return __fluent_libc_actor_schedule(actor);
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_ACTOR_LIBRARY_H
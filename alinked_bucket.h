@@ -0,0 +1,228 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_BUCKET_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_BUCKET_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Monotone Bucket Queue (Dial's Algorithm)
+// ----------------------------------------
+// Integer-keyed priority queue for monotone workloads (the popped key never
+// decreases, every inserted key is within `span` of the current minimum).
+// Every bucket is an arena linked queue; all buckets share one node pool.
+// A two-level bitmap lets the cursor jump over empty buckets.
+//
+// Macro-powered & Type-safe:
+//   DEFINE_ALINKED_BUCKET_QUEUE(T, name) – creates a bucket queue on top of
+//   `alinked_queue_<name>_t`, so DEFINE_ALINKED_NODE(T, name) must come first.
+//
+// Features:
+//   • O(1) insert.
+//   • Amortized O(1) pop-min: one bit scan per word of skipped buckets.
+//   • FIFO order among items with the same key.
+//
+// API Usage:
+// ----------------------------------------
+//   DEFINE_ALINKED_NODE(vertex_t, vertex);
+//   DEFINE_ALINKED_BUCKET_QUEUE(vertex_t, vertex);
+//   alinked_bucket_queue_vertex_t bq;
+//   alinked_bucket_queue_vertex_init(&bq, 1024, 512); // keys span < 1024
+//   alinked_bucket_queue_vertex_insert(&bq, dist, v);
+//
+//   size_t dist;
+//   vertex_t v;
+//   while (alinked_bucket_queue_vertex_pop_min(&bq, &dist, &v)) relax(v, dist);
+//   alinked_bucket_queue_vertex_destroy(&bq);
+//
+// Notes:
+//   - insert rejects keys below the cursor or beyond cursor + span.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <stdint.h>
+#include <stdlib.h>
+#include "alinked_queue.h"
+
+#define DEFINE_ALINKED_BUCKET_QUEUE(V, NAME)                \
+    typedef struct                                          \
+    {                                                       \
+        alinked_queue_##NAME##_t pool;                      \
+        alinked_queue_##NAME##_t *buckets;                  \
+        uint64_t *bitmap;                                   \
+        uint64_t *summary;                                  \
+        size_t mask;                                        \
+        size_t words;                                       \
+        size_t cursor;                                      \
+        size_t len;                                         \
+    } alinked_bucket_queue_##NAME##_t;                      \
+                                                            \
+    static inline void alinked_bucket_queue_##NAME##_destroy( \
+        alinked_bucket_queue_##NAME##_t *bq                 \
+    )                                                       \
+    {                                                       \
+        if (bq->buckets)                                    \
+        {                                                   \
+            for (size_t i = 0; i <= bq->mask; i++)          \
+            {                                               \
+                alinked_queue_##NAME##_destroy(&bq->buckets[i]); \
+            }                                               \
+        }                                                   \
+                                                            \
+        free(bq->buckets);                                  \
+        free(bq->bitmap);                                   \
+        free(bq->summary);                                  \
+        alinked_queue_##NAME##_destroy(&bq->pool);          \
+                                                            \
+        bq->buckets = NULL;                                 \
+        bq->bitmap = NULL;                                  \
+        bq->summary = NULL;                                 \
+        bq->len = 0;                                        \
+    }                                                       \
+                                                            \
+    static inline void alinked_bucket_queue_##NAME##_init(  \
+        alinked_bucket_queue_##NAME##_t *bq,                \
+        const size_t span,                                  \
+        const size_t arena_len                              \
+    )                                                       \
+    {                                                       \
+        size_t size = 64;                                   \
+        while (size < span)                                 \
+        {                                                   \
+            size <<= 1;                                     \
+        }                                                   \
+                                                            \
+        bq->mask = size - 1;                                \
+        bq->words = size / 64;                              \
+        bq->cursor = 0;                                     \
+        bq->len = 0;                                        \
+                                                            \
+        alinked_queue_##NAME##_init(&bq->pool, arena_len);  \
+        bq->buckets = (alinked_queue_##NAME##_t *)malloc(size * sizeof(alinked_queue_##NAME##_t)); \
+        bq->bitmap = (uint64_t *)calloc(bq->words, sizeof(uint64_t)); \
+        bq->summary = (uint64_t *)calloc((bq->words + 63) / 64, sizeof(uint64_t)); \
+                                                            \
+        if (!bq->pool.allocator || !bq->buckets || !bq->bitmap || !bq->summary) \
+        {                                                   \
+            free(bq->buckets);                              \
+            bq->buckets = NULL;                             \
+            alinked_bucket_queue_##NAME##_destroy(bq);      \
+            return;                                         \
+        }                                                   \
+                                                            \
+        for (size_t i = 0; i < size; i++)                   \
+        {                                                   \
+            alinked_queue_##NAME##_init_shared(&bq->buckets[i], &bq->pool); \
+        }                                                   \
+    }                                                       \
+                                                            \
+    static inline bool alinked_bucket_queue_##NAME##_insert( \
+        alinked_bucket_queue_##NAME##_t *bq,                \
+        const size_t key,                                   \
+        V data                                              \
+    )                                                       \
+    {                                                       \
+        if (key < bq->cursor || key - bq->cursor > bq->mask) \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        const size_t index = key & bq->mask;                \
+        alinked_queue_##NAME##_t *bucket = &bq->buckets[index]; \
+        const size_t before = bucket->len;                  \
+                                                            \
+        alinked_queue_##NAME##_append(bucket, data);        \
+        if (bucket->len == before)                          \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        bq->bitmap[index >> 6] |= 1ull << (index & 63);     \
+        bq->summary[index >> 12] |= 1ull << ((index >> 6) & 63); \
+        bq->len++;                                          \
+        return true;                                        \
+    }                                                       \
+                                                            \
+    static inline size_t __fluent_libc_##NAME##_bucket_queue_find( \
+        const alinked_bucket_queue_##NAME##_t *bq,          \
+        const size_t start                                  \
+    )                                                       \
+    {                                                       \
+        const size_t word = start >> 6;                     \
+        const uint64_t bits = bq->bitmap[word] & (~0ull << (start & 63)); \
+        if (bits)                                           \
+        {                                                   \
+            return (word << 6) + (size_t)__builtin_ctzll(bits); \
+        }                                                   \
+                                                            \
+        size_t step = 1;                                    \
+        while (step <= bq->words)                           \
+        {                                                   \
+            const size_t at = (word + step) & (bq->words - 1); \
+            const uint64_t summary = bq->summary[at >> 6] >> (at & 63); \
+            if (summary)                                    \
+            {                                               \
+                const size_t found = (at + (size_t)__builtin_ctzll(summary)) & (bq->words - 1); \
+                return (found << 6) + (size_t)__builtin_ctzll(bq->bitmap[found]); \
+            }                                               \
+                                                            \
+            const size_t to_boundary = 64 - (at & 63);      \
+            const size_t to_wrap = bq->words - at;          \
+            step += to_boundary < to_wrap ? to_boundary : to_wrap; \
+        }                                                   \
+                                                            \
+        return SIZE_MAX;                                    \
+    }                                                       \
+                                                            \
+    static inline bool alinked_bucket_queue_##NAME##_pop_min( \
+        alinked_bucket_queue_##NAME##_t *bq,                \
+        size_t *key,                                        \
+        V *data                                             \
+    )                                                       \
+    {                                                       \
+        if (bq->len == 0)                                   \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        const size_t start = bq->cursor & bq->mask;         \
+        const size_t index = __fluent_libc_##NAME##_bucket_queue_find(bq, start); \
+        alinked_queue_##NAME##_t *bucket = &bq->buckets[index]; \
+                                                            \
+        bq->cursor += (index - start) & bq->mask;           \
+        *key = bq->cursor;                                  \
+        *data = alinked_queue_##NAME##_shift(bucket);       \
+        bq->len--;                                          \
+                                                            \
+        if (bucket->len == 0)                               \
+        {                                                   \
+            bq->bitmap[index >> 6] &= ~(1ull << (index & 63)); \
+            if (bq->bitmap[index >> 6] == 0)                \
+            {                                               \
+                bq->summary[index >> 12] &= ~(1ull << ((index >> 6) & 63)); \
+            }                                               \
+        }                                                   \
+                                                            \
+        return true;                                        \
+    }
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_BUCKET_LIBRARY_H
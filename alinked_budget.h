@@ -0,0 +1,372 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_BUDGET_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_BUDGET_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Memory Budget
+// ----------------------------------------
+// Byte budget shared by any number of queues (one per process, or one per
+// tenant group). Every node a pool takes fresh from its arena is charged to
+// the budget; destroying the pool's owner gives the bytes back. Threads
+// reserve budget in `reservation`-sized slices, so most charges are a
+// thread-local subtraction.
+//
+// API Usage:
+// ----------------------------------------
+//   #define ALINKED_MEMORY_BUDGET // before alinked_queue.h, or -DALINKED_MEMORY_BUDGET
+//   #include "alinked_queue.h"
+//
+//   alinked_budget_t budget;
+//   alinked_budget_init(&budget, 256u << 20, ALINKED_BUDGET_REJECT); // 256 MiB
+//   alinked_queue_int_set_budget(&q, &budget); // on the pool owner, early
+//   alinked_mpsc_msg_t m;                      // wrappers: budget their pool
+//   alinked_queue_msg_set_budget(&m.pool, &budget);
+//
+//   // optional: free memory elsewhere, return true to retry the charge
+//   alinked_budget_set_spill(&budget, evict_cold_tenants, ctx);
+//
+//   alinked_budget_thread_release(); // hand back this thread's slice early
+//
+// Exhaustion Policies:
+//   • REJECT – the append fails (the node allocation returns NULL).
+//   • BLOCK  – the appending thread waits until bytes are given back.
+//   • SPILL  – the spill hook runs first; REJECT if it frees nothing.
+//
+// Notes:
+//   - The charge sits on the arena path only; free-list reuse is not charged,
+//     and neither are nodes the pool took before the budget was set.
+//   - Without ALINKED_MEMORY_BUDGET the queue only carries a NULL account
+//     pointer and `set_budget` returns false; this header is not included.
+//   - A pool's budget can be swapped or cleared until it charges a node.
+//   - Queues sharing a pool read the owner's account through the owner, so a
+//     budget set on the owner later applies to them too; the owner releases
+//     the account when it destroys the arena.
+//   - Up to `reservation - 1` bytes per thread can sit in thread slices. A
+//     thread's first charge registers a pthread key whose destructor returns
+//     the slice at thread exit, so BLOCK waiters survive thread churn.
+//   - `used` counts bytes charged to nodes, not bytes parked in slices.
+//   - A BLOCK charger that finds the budget empty bumps a reclaim epoch
+//     before it sleeps; every other thread hands its slice back on its next
+//     charge. A thread that never charges again keeps its slice until it
+//     exits or calls alinked_budget_thread_release.
+//   - BLOCK waits inside the allocation; avoid it for queues whose pool is
+//     shared behind a lock (MPSC) unless every producer may block.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include "alinked_wait.h"
+
+#ifndef ALINKED_BUDGET_RESERVATION
+#   define ALINKED_BUDGET_RESERVATION (64u << 10)
+#endif
+
+typedef enum
+{
+    ALINKED_BUDGET_REJECT = 0,
+    ALINKED_BUDGET_BLOCK,
+    ALINKED_BUDGET_SPILL
+} alinked_budget_policy_t;
+
+typedef struct alinked_budget_t alinked_budget_t;
+typedef bool (*alinked_budget_spill_fn)(alinked_budget_t *budget, size_t bytes, void *ctx);
+
+struct alinked_budget_t
+{
+    _Alignas(ALINKED_CACHE_LINE) atomic_size_t available;
+    atomic_size_t waiters;
+    alinked_signal_t signal;
+    atomic_uint reclaim;
+    _Alignas(ALINKED_CACHE_LINE) atomic_size_t charged;
+    size_t limit;
+    size_t reservation;
+    alinked_budget_policy_t policy;
+    alinked_wait_strategy_t wait;
+    alinked_budget_spill_fn spill;
+    void *spill_ctx;
+};
+
+typedef struct
+{
+    alinked_budget_t *budget;
+    size_t bytes;
+    unsigned reclaim;
+} alinked_budget_local_t;
+
+typedef struct alinked_budget_account_t alinked_budget_account_t;
+
+struct alinked_budget_account_t
+{
+    alinked_budget_t *budget;
+    size_t bytes;
+};
+
+__attribute__((weak)) _Thread_local alinked_budget_local_t alinked_budget_local;
+__attribute__((weak)) pthread_key_t alinked_budget_key;
+__attribute__((weak)) pthread_once_t alinked_budget_once = PTHREAD_ONCE_INIT;
+
+static inline void alinked_budget_init(
+    alinked_budget_t *budget,
+    const size_t limit,
+    const alinked_budget_policy_t policy
+)
+{
+    atomic_init(&budget->available, limit);
+    atomic_init(&budget->waiters, 0);
+    alinked_signal_init(&budget->signal);
+    atomic_init(&budget->reclaim, 0);
+    atomic_init(&budget->charged, 0);
+    budget->limit = limit;
+    budget->reservation = ALINKED_BUDGET_RESERVATION;
+    budget->policy = policy;
+    budget->wait = ALINKED_WAIT_PARK;
+    budget->spill = NULL;
+    budget->spill_ctx = NULL;
+}
+
+static inline void alinked_budget_set_spill(
+    alinked_budget_t *budget,
+    const alinked_budget_spill_fn spill,
+    void *ctx
+)
+{
+    budget->spill = spill;
+    budget->spill_ctx = ctx;
+}
+
+static inline size_t alinked_budget_used(alinked_budget_t *budget)
+{
+    return atomic_load_explicit(&budget->charged, memory_order_relaxed);
+}
+
+static inline void __fluent_libc_budget_give(alinked_budget_t *budget, const size_t bytes)
+{
+    atomic_fetch_add(&budget->available, bytes);
+    if (atomic_load(&budget->waiters) > 0)
+    {
+        alinked_signal_broadcast(&budget->signal);
+    }
+}
+
+static inline void alinked_budget_release(alinked_budget_t *budget, const size_t bytes)
+{
+    atomic_fetch_sub_explicit(&budget->charged, bytes, memory_order_relaxed);
+    __fluent_libc_budget_give(budget, bytes);
+}
+
+static inline void alinked_budget_thread_release(void)
+{
+    alinked_budget_local_t *local = &alinked_budget_local;
+    if (local->budget && local->bytes > 0)
+    {
+        __fluent_libc_budget_give(local->budget, local->bytes);
+    }
+
+    local->budget = NULL;
+    local->bytes = 0;
+}
+
+static inline void __fluent_libc_budget_thread_exit(void *unused)
+{
+    (void)unused;
+    alinked_budget_thread_release();
+}
+
+static inline void __fluent_libc_budget_key_create(void)
+{
+    pthread_key_create(&alinked_budget_key, __fluent_libc_budget_thread_exit);
+}
+
+static inline void __fluent_libc_budget_thread_enter(void)
+{
+    pthread_once(&alinked_budget_once, __fluent_libc_budget_key_create);
+    pthread_setspecific(alinked_budget_key, &alinked_budget_local);
+}
+
+static inline bool __fluent_libc_budget_reserve(alinked_budget_t *budget, const size_t bytes)
+{
+    alinked_budget_local_t *local = &alinked_budget_local;
+    // no fresh slices while a charger is blocked: they would starve it
+    const size_t want = bytes > budget->reservation || atomic_load(&budget->waiters) > 0
+        ? bytes
+        : budget->reservation;
+    size_t available = atomic_load(&budget->available);
+
+    for (;;)
+    {
+        if (available < bytes)
+        {
+            return false;
+        }
+
+        const size_t take = available < want ? available : want;
+        if (atomic_compare_exchange_weak(&budget->available, &available, available - take))
+        {
+            local->bytes += take - bytes;
+            return true;
+        }
+    }
+}
+
+static inline bool __fluent_libc_budget_charge(alinked_budget_t *budget, const size_t bytes)
+{
+    alinked_budget_local_t *local = &alinked_budget_local;
+    const unsigned reclaim = atomic_load_explicit(&budget->reclaim, memory_order_relaxed);
+
+    if (local->budget == budget && local->reclaim == reclaim && local->bytes >= bytes)
+    {
+        local->bytes -= bytes;
+        return true;
+    }
+
+    if (local->budget != budget || local->reclaim != reclaim)
+    {
+        // a blocked charger asked every slice back, or the budget changed
+        alinked_budget_thread_release();
+        local->budget = budget;
+        local->reclaim = reclaim;
+        __fluent_libc_budget_thread_enter();
+    }
+
+    if (__fluent_libc_budget_reserve(budget, bytes))
+    {
+        return true;
+    }
+
+    if (budget->policy == ALINKED_BUDGET_SPILL)
+    {
+        while (budget->spill && budget->spill(budget, bytes, budget->spill_ctx))
+        {
+            if (__fluent_libc_budget_reserve(budget, bytes))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    if (budget->policy != ALINKED_BUDGET_BLOCK)
+    {
+        return false;
+    }
+
+    size_t spins = 0;
+    bool charged = false;
+    atomic_fetch_add(&budget->waiters, 1);
+
+    while (!charged)
+    {
+        const unsigned epoch = alinked_signal_prepare(&budget->signal);
+        charged = __fluent_libc_budget_reserve(budget, bytes);
+        if (!charged)
+        {
+            atomic_fetch_add(&budget->reclaim, 1);
+            alinked_wait_signal(budget->wait, &budget->signal, epoch, &spins);
+        }
+    }
+
+    atomic_fetch_sub(&budget->waiters, 1);
+    alinked_budget_local.reclaim = atomic_load_explicit(&budget->reclaim, memory_order_relaxed);
+    return true;
+}
+
+static inline bool alinked_budget_charge(alinked_budget_t *budget, const size_t bytes)
+{
+    if (!__fluent_libc_budget_charge(budget, bytes))
+    {
+        return false;
+    }
+
+    atomic_fetch_add_explicit(&budget->charged, bytes, memory_order_relaxed);
+    return true;
+}
+
+static inline bool alinked_budget_account_set(
+    alinked_budget_account_t **account,
+    alinked_budget_t *budget
+)
+{
+    if (*account && (*account)->bytes > 0)
+    {
+        return false;
+    }
+
+    if (!budget)
+    {
+        free(*account);
+        *account = NULL;
+        return true;
+    }
+
+    if (!*account)
+    {
+        *account = (alinked_budget_account_t *)malloc(sizeof(alinked_budget_account_t));
+        if (!*account)
+        {
+            return false;
+        }
+
+        (*account)->bytes = 0;
+    }
+
+    (*account)->budget = budget;
+    return true;
+}
+
+static inline bool alinked_budget_account_charge(
+    alinked_budget_account_t *account,
+    const size_t bytes
+)
+{
+    if (!alinked_budget_charge(account->budget, bytes))
+    {
+        return false;
+    }
+
+    account->bytes += bytes;
+    return true;
+}
+
+static inline void alinked_budget_account_refund(
+    alinked_budget_account_t *account,
+    const size_t bytes
+)
+{
+    account->bytes -= bytes;
+    alinked_budget_release(account->budget, bytes);
+}
+
+static inline void alinked_budget_account_close(alinked_budget_account_t *account)
+{
+    alinked_budget_release(account->budget, account->bytes);
+    free(account);
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_BUDGET_LIBRARY_H
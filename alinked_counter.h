@@ -0,0 +1,133 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_COUNTER_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_COUNTER_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Striped Counter
+// ----------------------------------------
+// Monotonic counter split over cache-line sized stripes. Each thread adds
+// to its own stripe, so concurrent writers never bounce a shared line;
+// readers pay for summing the stripes instead.
+//
+// API Usage:
+// ----------------------------------------
+//   alinked_counter_t pushed;
+//   alinked_counter_init(&pushed);
+//   alinked_counter_add(&pushed, 1);             // any thread, no contention
+//   size_t approx = alinked_counter_sum(&pushed); // may miss in-flight adds
+//   size_t exact = alinked_counter_sum_stable(&pushed, &popped);
+//
+// Notes:
+//   - Stripes only grow, so two identical sums in a row mean the counter
+//     held that value in between; sum_stable retries until that happens.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <stdatomic.h>
+#include <stddef.h>
+#include "alinked_wait.h"
+
+#ifndef ALINKED_COUNTER_STRIPES
+#   define ALINKED_COUNTER_STRIPES 8 // power of two
+#endif
+
+typedef struct
+{
+    struct
+    {
+        _Alignas(ALINKED_CACHE_LINE) atomic_size_t value;
+    } stripes[ALINKED_COUNTER_STRIPES];
+} alinked_counter_t;
+
+static inline size_t alinked_counter_stripe(void)
+{
+    static atomic_uint next;
+    static _Thread_local unsigned stripe;
+    static _Thread_local bool assigned;
+
+    if (!assigned)
+    {
+        stripe = atomic_fetch_add_explicit(&next, 1, memory_order_relaxed);
+        assigned = true;
+    }
+
+    return stripe & (ALINKED_COUNTER_STRIPES - 1);
+}
+
+static inline void alinked_counter_init(alinked_counter_t *counter)
+{
+    for (size_t i = 0; i < ALINKED_COUNTER_STRIPES; i++)
+    {
+        atomic_init(&counter->stripes[i].value, 0);
+    }
+}
+
+static inline void alinked_counter_add(alinked_counter_t *counter, const size_t delta)
+{
+    atomic_fetch_add_explicit(&counter->stripes[alinked_counter_stripe()].value, delta, memory_order_relaxed);
+}
+
+static inline size_t alinked_counter_sum(alinked_counter_t *counter)
+{
+    size_t sum = 0;
+    for (size_t i = 0; i < ALINKED_COUNTER_STRIPES; i++)
+    {
+        sum += atomic_load_explicit(&counter->stripes[i].value, memory_order_relaxed);
+    }
+
+    return sum;
+}
+
+static inline size_t alinked_counter_sum_stable(
+    alinked_counter_t *counter,
+    const atomic_size_t *subtract
+)
+{
+    for (;;)
+    {
+        size_t before = 0;
+        for (size_t i = 0; i < ALINKED_COUNTER_STRIPES; i++)
+        {
+            before += atomic_load_explicit(&counter->stripes[i].value, memory_order_seq_cst);
+        }
+
+        const size_t taken = subtract ? atomic_load_explicit(subtract, memory_order_seq_cst) : 0;
+
+        size_t after = 0;
+        for (size_t i = 0; i < ALINKED_COUNTER_STRIPES; i++)
+        {
+            after += atomic_load_explicit(&counter->stripes[i].value, memory_order_seq_cst);
+        }
+
+        if (before == after)
+        {
+            return before > taken ? before - taken : 0;
+        }
+
+        alinked_cpu_relax();
+    }
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_COUNTER_LIBRARY_H
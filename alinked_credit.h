@@ -0,0 +1,253 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_CREDIT_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_CREDIT_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Credit-Based Flow Control
+// ----------------------------------------
+// Bounds the number of items in flight between producers and consumers of
+// any queue variant. A pool starts with `capacity` credits; a producer
+// spends one per item it enqueues and a consumer grants one back per item
+// it drains. Both sides batch their accounting locally, so the shared pool
+// sees one atomic per `batch` items instead of one per item.
+//
+// API Usage:
+// ----------------------------------------
+//   alinked_credit_t credits;
+//   alinked_credit_init(&credits, 4096, ALINKED_WAIT_PARK); // at most 4096 in flight
+//
+//   alinked_credit_producer_t out;                // one per producing thread
+//   alinked_credit_producer_init(&out, &credits, 64);
+//   alinked_credit_acquire(&out, 1);              // blocks when out of credit
+//   if (!alinked_spsc_msg_push(&q, msg))          // (try_acquire fails instead)
+//       alinked_credit_refund(&out, 1);           // hand back what went unused
+//
+//   alinked_credit_consumer_t in;                 // one per consuming thread
+//   alinked_credit_consumer_init(&in, &credits, 64);
+//   size_t got = alinked_spsc_msg_pop_batch(&q, buf, 64);
+//   alinked_credit_grant(&in, got);
+//
+// Notes:
+//   - Asking for more than `capacity` credits at once can never succeed:
+//     acquire returns false instead of blocking forever.
+//   - Producers take credit in `batch` chunks and keep the rest locally, so
+//     up to `batch - 1` credits per producer can sit unused; return them with
+//     alinked_credit_producer_release before a producer goes away.
+//   - Grants are held back until `batch` accumulate, unless a producer is
+//     blocked, in which case they are flushed at once. A consumer that finds
+//     its queue empty must call alinked_credit_flush, or the last few grants
+//     can stay parked with it.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "alinked_wait.h"
+
+typedef struct
+{
+    _Alignas(ALINKED_CACHE_LINE) atomic_size_t available;
+    atomic_size_t waiters;
+    alinked_signal_t signal;
+    alinked_wait_strategy_t wait;
+    size_t capacity;
+} alinked_credit_t;
+
+typedef struct
+{
+    alinked_credit_t *pool;
+    size_t cached;
+    size_t batch;
+} alinked_credit_producer_t;
+
+typedef struct
+{
+    alinked_credit_t *pool;
+    size_t pending;
+    size_t batch;
+} alinked_credit_consumer_t;
+
+static inline void alinked_credit_init(
+    alinked_credit_t *credit,
+    const size_t capacity,
+    const alinked_wait_strategy_t wait
+)
+{
+    atomic_init(&credit->available, capacity);
+    atomic_init(&credit->waiters, 0);
+    alinked_signal_init(&credit->signal);
+    credit->wait = wait;
+    credit->capacity = capacity;
+}
+
+static inline size_t alinked_credit_available(alinked_credit_t *credit)
+{
+    return atomic_load_explicit(&credit->available, memory_order_relaxed);
+}
+
+static inline void alinked_credit_producer_init(
+    alinked_credit_producer_t *producer,
+    alinked_credit_t *pool,
+    const size_t batch
+)
+{
+    producer->pool = pool;
+    producer->cached = 0;
+    producer->batch = batch ? batch : 1;
+}
+
+static inline void alinked_credit_consumer_init(
+    alinked_credit_consumer_t *consumer,
+    alinked_credit_t *pool,
+    const size_t batch
+)
+{
+    consumer->pool = pool;
+    consumer->pending = 0;
+    consumer->batch = batch ? batch : 1;
+}
+
+static inline bool alinked_credit_try_acquire(
+    alinked_credit_producer_t *producer,
+    const size_t count
+)
+{
+    if (producer->cached >= count)
+    {
+        producer->cached -= count;
+        return true;
+    }
+
+    const size_t need = count - producer->cached;
+    const size_t want = need > producer->batch ? need : producer->batch;
+    size_t available = atomic_load(&producer->pool->available);
+
+    for (;;)
+    {
+        if (available < need)
+        {
+            return false;
+        }
+
+        const size_t take = available < want ? available : want;
+        if (atomic_compare_exchange_weak_explicit(&producer->pool->available, &available, available - take,
+            memory_order_acquire, memory_order_relaxed))
+        {
+            producer->cached += take - count;
+            return true;
+        }
+    }
+}
+
+static inline bool alinked_credit_acquire(
+    alinked_credit_producer_t *producer,
+    const size_t count
+)
+{
+    if (alinked_credit_try_acquire(producer, count))
+    {
+        return true;
+    }
+
+    // the pool never holds more than `capacity`, waiting would never end
+    if (count > producer->pool->capacity)
+    {
+        return false;
+    }
+
+    alinked_credit_t *pool = producer->pool;
+    size_t spins = 0;
+
+    atomic_fetch_add(&pool->waiters, 1);
+    for (;;)
+    {
+        const unsigned epoch = alinked_signal_prepare(&pool->signal);
+        if (alinked_credit_try_acquire(producer, count))
+        {
+            break;
+        }
+
+        alinked_wait_signal(pool->wait, &pool->signal, epoch, &spins);
+    }
+
+    atomic_fetch_sub(&pool->waiters, 1);
+    return true;
+}
+
+static inline void __fluent_libc_credit_put(alinked_credit_t *pool, const size_t count)
+{
+    atomic_fetch_add(&pool->available, count);
+    if (atomic_load(&pool->waiters) > 0)
+    {
+        alinked_signal_broadcast(&pool->signal);
+    }
+}
+
+static inline void alinked_credit_producer_release(alinked_credit_producer_t *producer)
+{
+    if (producer->cached > 0)
+    {
+        __fluent_libc_credit_put(producer->pool, producer->cached);
+        producer->cached = 0;
+    }
+}
+
+static inline void alinked_credit_refund(
+    alinked_credit_producer_t *producer,
+    const size_t count
+)
+{
+    producer->cached += count;
+    if (producer->cached > producer->batch)
+    {
+        __fluent_libc_credit_put(producer->pool, producer->cached - producer->batch);
+        producer->cached = producer->batch;
+    }
+}
+
+static inline void alinked_credit_flush(alinked_credit_consumer_t *consumer)
+{
+    if (consumer->pending > 0)
+    {
+        __fluent_libc_credit_put(consumer->pool, consumer->pending);
+        consumer->pending = 0;
+    }
+}
+
+static inline void alinked_credit_grant(
+    alinked_credit_consumer_t *consumer,
+    const size_t count
+)
+{
+    consumer->pending += count;
+    if (consumer->pending >= consumer->batch ||
+        atomic_load_explicit(&consumer->pool->waiters, memory_order_relaxed) > 0)
+    {
+        alinked_credit_flush(consumer);
+    }
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_CREDIT_LIBRARY_H
@@ -0,0 +1,342 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_DISRUPTOR_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_DISRUPTOR_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Disruptor-Style Multi-Stage Ring
+// ----------------------------------------
+// A preallocated ring of slots shared by a single producer and a chain (or
+// diamond) of consumer stages. Items are written once and never move: every
+// stage only advances its own sequence counter, gated on the sequences of the
+// stages (or producer) it depends on.
+//
+// Macro-powered & Type-safe:
+//   DEFINE_ALINKED_DISRUPTOR(T, name) – creates a ring type and API for type `T`.
+//
+// Features:
+//   • Zero copies between stages, slots are touched in place.
+//   • Batch-aware consumers: one barrier check hands out every available slot.
+//   • Configurable wait strategy (see `alinked_wait.h`).
+//
+// API Usage:
+// ----------------------------------------
+//   DEFINE_ALINKED_DISRUPTOR(event_t, event);
+//   alinked_disruptor_event_t d;
+//   alinked_disruptor_event_init(&d, 1024, ALINKED_WAIT_YIELD);
+//   size_t decode = alinked_disruptor_event_add_stage(&d, ALINKED_DISRUPTOR_PRODUCER);
+//   size_t enrich = alinked_disruptor_event_add_stage(&d, decode);
+//   size_t audit = alinked_disruptor_event_add_stage(&d, decode);
+//   size_t joins[] = { enrich, audit };                 // diamond: waits for both
+//   size_t store = alinked_disruptor_event_add_stage_after(&d, joins, 2);
+//
+//   // producer
+//   size_t seq = alinked_disruptor_event_claim(&d, 1); // NONE if n > capacity or halted
+//   *alinked_disruptor_event_slot(&d, seq) = ev;
+//   alinked_disruptor_event_publish(&d, seq + 1);
+//
+//   // stage thread
+//   size_t next = alinked_disruptor_event_sequence(&d, enrich);
+//   size_t end = alinked_disruptor_event_wait_for(&d, enrich);
+//   if (end == ALINKED_DISRUPTOR_NONE) return; // halted
+//   for (; next < end; next++) work(alinked_disruptor_event_slot(&d, next));
+//   alinked_disruptor_event_release(&d, enrich, end);
+//
+//   // teardown: stop producing, optionally wait for the last stage to reach
+//   // the published cursor, then halt and join every stage thread
+//   alinked_disruptor_event_halt(&d);
+//
+// Notes:
+//   - Exactly one producer thread and exactly one thread per stage.
+//   - Stages must be added before any thread starts, gates point backwards only.
+//   - A stage may gate on up to ALINKED_DISRUPTOR_MAX_GATES upstream stages
+//     and sees the minimum of their sequences.
+//   - If init fails to allocate, or the capacity cannot be rounded up to a
+//     power of two that fits in memory, `slots` stays NULL and claim
+//     returns NONE.
+//   - Sequences are counts: a stage at `n` has finished slots [0, n).
+//   - halt wakes every stage blocked in wait_for, and a producer blocked in
+//     claim, with ALINKED_DISRUPTOR_NONE. Slots already available are still
+//     handed out first, but a stage does not wait for upstream stages still
+//     working: to drain, halt only once the last stage reached the cursor.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "alinked_wait.h"
+
+#ifndef ALINKED_DISRUPTOR_MAX_STAGES
+#   define ALINKED_DISRUPTOR_MAX_STAGES 8
+#endif
+
+#ifndef ALINKED_DISRUPTOR_MAX_GATES
+#   define ALINKED_DISRUPTOR_MAX_GATES 4
+#endif
+
+#define ALINKED_DISRUPTOR_PRODUCER ((size_t)-1)
+#define ALINKED_DISRUPTOR_NONE ((size_t)-1)
+
+typedef struct
+{
+    _Alignas(ALINKED_CACHE_LINE) atomic_size_t value;
+    char pad[ALINKED_CACHE_LINE - sizeof(atomic_size_t)];
+} alinked_sequence_t;
+
+#define DEFINE_ALINKED_DISRUPTOR(V, NAME)                   \
+    typedef struct                                          \
+    {                                                       \
+        alinked_sequence_t cursor;                          \
+        alinked_sequence_t stages[ALINKED_DISRUPTOR_MAX_STAGES]; \
+        size_t gates[ALINKED_DISRUPTOR_MAX_STAGES][ALINKED_DISRUPTOR_MAX_GATES]; \
+        size_t gate_count[ALINKED_DISRUPTOR_MAX_STAGES];    \
+        size_t stage_count;                                 \
+        V *slots;                                           \
+        size_t mask;                                        \
+        size_t claimed;                                     \
+        size_t cached_min;                                  \
+        alinked_wait_strategy_t wait;                       \
+        atomic_bool halted;                                 \
+    } alinked_disruptor_##NAME##_t;                         \
+                                                            \
+    static inline void alinked_disruptor_##NAME##_init(     \
+        alinked_disruptor_##NAME##_t *disruptor,            \
+        const size_t capacity,                              \
+        const alinked_wait_strategy_t wait                  \
+    )                                                       \
+    {                                                       \
+        atomic_init(&disruptor->cursor.value, 0);           \
+        disruptor->stage_count = 0;                         \
+        disruptor->claimed = 0;                             \
+        disruptor->cached_min = 0;                          \
+        disruptor->wait = wait;                             \
+        atomic_init(&disruptor->halted, false);             \
+        disruptor->slots = NULL;                            \
+        disruptor->mask = 0;                                \
+                                                            \
+        if (capacity > SIZE_MAX / 2 + 1)                    \
+        {                                                   \
+            return;                                         \
+        }                                                   \
+                                                            \
+        size_t size = 1;                                    \
+        while (size < capacity)                             \
+        {                                                   \
+            size <<= 1;                                     \
+        }                                                   \
+                                                            \
+        if (size > SIZE_MAX / sizeof(V))                    \
+        {                                                   \
+            return;                                         \
+        }                                                   \
+                                                            \
+        disruptor->slots = (V *)malloc(size * sizeof(V));   \
+        disruptor->mask = disruptor->slots ? size - 1 : 0;  \
+    }                                                       \
+                                                            \
+    static inline void alinked_disruptor_##NAME##_destroy(  \
+        alinked_disruptor_##NAME##_t *disruptor             \
+    )                                                       \
+    {                                                       \
+        free(disruptor->slots);                             \
+        disruptor->slots = NULL;                            \
+        disruptor->stage_count = 0;                         \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_disruptor_##NAME##_add_stage_after( \
+        alinked_disruptor_##NAME##_t *disruptor,            \
+        const size_t *gates,                                \
+        const size_t count                                  \
+    )                                                       \
+    {                                                       \
+        const size_t stage = disruptor->stage_count;        \
+        if (stage == ALINKED_DISRUPTOR_MAX_STAGES || count == 0 || count > ALINKED_DISRUPTOR_MAX_GATES) \
+        {                                                   \
+            return ALINKED_DISRUPTOR_NONE;                  \
+        }                                                   \
+                                                            \
+        for (size_t i = 0; i < count; i++)                  \
+        {                                                   \
+            if (gates[i] != ALINKED_DISRUPTOR_PRODUCER && gates[i] >= stage) \
+            {                                               \
+                return ALINKED_DISRUPTOR_NONE;              \
+            }                                               \
+                                                            \
+            disruptor->gates[stage][i] = gates[i];          \
+        }                                                   \
+                                                            \
+        atomic_init(&disruptor->stages[stage].value,        \
+            atomic_load_explicit(&disruptor->cursor.value, memory_order_relaxed)); \
+        disruptor->gate_count[stage] = count;               \
+        disruptor->stage_count++;                           \
+        return stage;                                       \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_disruptor_##NAME##_add_stage( \
+        alinked_disruptor_##NAME##_t *disruptor,            \
+        const size_t gate                                   \
+    )                                                       \
+    {                                                       \
+        return alinked_disruptor_##NAME##_add_stage_after(disruptor, &gate, 1); \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_disruptor_##NAME##_sequence( \
+        alinked_disruptor_##NAME##_t *disruptor,            \
+        const size_t stage                                  \
+    )                                                       \
+    {                                                       \
+        return atomic_load_explicit(&disruptor->stages[stage].value, memory_order_relaxed); \
+    }                                                       \
+                                                            \
+    static inline V *alinked_disruptor_##NAME##_slot(       \
+        const alinked_disruptor_##NAME##_t *disruptor,      \
+        const size_t sequence                               \
+    )                                                       \
+    {                                                       \
+        return &disruptor->slots[sequence & disruptor->mask]; \
+    }                                                       \
+                                                            \
+    static inline size_t __fluent_libc_##NAME##_disruptor_min( \
+        alinked_disruptor_##NAME##_t *disruptor             \
+    )                                                       \
+    {                                                       \
+        size_t min = disruptor->claimed;                    \
+        for (size_t i = 0; i < disruptor->stage_count; i++) \
+        {                                                   \
+            const size_t seq = atomic_load_explicit(&disruptor->stages[i].value, memory_order_acquire); \
+            if (seq < min)                                  \
+            {                                               \
+                min = seq;                                  \
+            }                                               \
+        }                                                   \
+                                                            \
+        return min;                                         \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_disruptor_##NAME##_claim(  \
+        alinked_disruptor_##NAME##_t *disruptor,            \
+        const size_t n                                      \
+    )                                                       \
+    {                                                       \
+        if (!disruptor->slots || n == 0 || n > disruptor->mask + 1) \
+        {                                                   \
+            return ALINKED_DISRUPTOR_NONE;                  \
+        }                                                   \
+                                                            \
+        const size_t first = disruptor->claimed;            \
+        const size_t wrap = first + n - (disruptor->mask + 1); \
+        size_t spins = 0;                                   \
+                                                            \
+        if (first + n > disruptor->mask + 1)                \
+        {                                                   \
+            while (disruptor->cached_min < wrap)            \
+            {                                               \
+                disruptor->cached_min = __fluent_libc_##NAME##_disruptor_min(disruptor); \
+                if (disruptor->cached_min < wrap)           \
+                {                                           \
+                    if (atomic_load_explicit(&disruptor->halted, memory_order_acquire)) \
+                    {                                       \
+                        return ALINKED_DISRUPTOR_NONE;      \
+                    }                                       \
+                                                            \
+                    alinked_wait_idle(disruptor->wait, &spins); \
+                }                                           \
+            }                                               \
+        }                                                   \
+                                                            \
+        disruptor->claimed = first + n;                     \
+        return first;                                       \
+    }                                                       \
+                                                            \
+    static inline void alinked_disruptor_##NAME##_publish(  \
+        alinked_disruptor_##NAME##_t *disruptor,            \
+        const size_t upto                                   \
+    )                                                       \
+    {                                                       \
+        atomic_store_explicit(&disruptor->cursor.value, upto, memory_order_release); \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_disruptor_##NAME##_try_wait_for( \
+        alinked_disruptor_##NAME##_t *disruptor,            \
+        const size_t stage                                  \
+    )                                                       \
+    {                                                       \
+        size_t min = (size_t)-1;                            \
+        for (size_t i = 0; i < disruptor->gate_count[stage]; i++) \
+        {                                                   \
+            const size_t gate = disruptor->gates[stage][i]; \
+            const alinked_sequence_t *upstream = gate == ALINKED_DISRUPTOR_PRODUCER \
+                ? &disruptor->cursor                        \
+                : &disruptor->stages[gate];                 \
+            const size_t seq = atomic_load_explicit(&upstream->value, memory_order_acquire); \
+            if (seq < min)                                  \
+            {                                               \
+                min = seq;                                  \
+            }                                               \
+        }                                                   \
+                                                            \
+        return min;                                         \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_disruptor_##NAME##_wait_for( \
+        alinked_disruptor_##NAME##_t *disruptor,            \
+        const size_t stage                                  \
+    )                                                       \
+    {                                                       \
+        const size_t next = alinked_disruptor_##NAME##_sequence(disruptor, stage); \
+        size_t available = alinked_disruptor_##NAME##_try_wait_for(disruptor, stage); \
+        size_t spins = 0;                                   \
+                                                            \
+        while (available <= next)                           \
+        {                                                   \
+            if (atomic_load_explicit(&disruptor->halted, memory_order_acquire)) \
+            {                                               \
+                return ALINKED_DISRUPTOR_NONE;              \
+            }                                               \
+                                                            \
+            alinked_wait_idle(disruptor->wait, &spins);     \
+            available = alinked_disruptor_##NAME##_try_wait_for(disruptor, stage); \
+        }                                                   \
+                                                            \
+        return available;                                   \
+    }                                                       \
+                                                            \
+    static inline void alinked_disruptor_##NAME##_halt(     \
+        alinked_disruptor_##NAME##_t *disruptor             \
+    )                                                       \
+    {                                                       \
+        atomic_store_explicit(&disruptor->halted, true, memory_order_release); \
+    }                                                       \
+                                                            \
+    static inline void alinked_disruptor_##NAME##_release(  \
+        alinked_disruptor_##NAME##_t *disruptor,            \
+        const size_t stage,                                 \
+        const size_t upto                                   \
+    )                                                       \
+    {                                                       \
+        atomic_store_explicit(&disruptor->stages[stage].value, upto, memory_order_release); \
+    }
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_DISRUPTOR_LIBRARY_H
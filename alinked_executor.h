@@ -0,0 +1,359 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_EXECUTOR_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_EXECUTOR_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Elastic Task Executor
+// ----------------------------------------
+// Thread pool on top of the thread-safe linked queue (`alinked_sync.h`).
+// Tasks are `fn(arg)` pairs stamped with their submission time. The pool
+// grows while the backlog is deep or tasks wait too long, and shrinks back
+// to `min_workers` once workers stay idle.
+//
+// Scaling Rules:
+//   • Grow when depth > depth_per_worker * workers.
+//   • Grow when the last observed sojourn time exceeds max_sojourn_ns.
+//   • A worker idle for idle_ns retires, unless that would go below min.
+//
+// API Usage:
+// ----------------------------------------
+//   alinked_executor_config_t cfg;
+//   alinked_executor_config_default(&cfg);
+//   cfg.max_workers = 16;
+//   cfg.wait = ALINKED_WAIT_PARK;
+//
+//   alinked_executor_t ex;
+//   alinked_executor_init(&ex, &cfg);
+//   if (!alinked_executor_submit(&ex, work, arg)) work(arg); // false: no node for it
+//   while (!done) alinked_executor_run_one(&ex); // wait by helping instead of blocking
+//   alinked_executor_destroy(&ex); // runs what is left, then joins
+//
+// Notes:
+//   - Workers are detached; destroy waits for every one of them to exit.
+//   - Tasks submitted after destroy starts are not guaranteed to run.
+//   - submit returns false (submit_batch a short count) when the task queue
+//     cannot allocate; the tasks not counted were not queued.
+//   - A retiring worker re-checks the queue after giving up its slot, and a
+//     submit that finds no worker spawns one, so min_workers = 0 never
+//     leaves a task stranded.
+//   - A thread waiting on tasks it submitted should run_one while it waits:
+//     that keeps it from deadlocking when called from a task on a full pool.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include "alinked_queue.h"
+#include "alinked_sync.h"
+#include "alinked_wait.h"
+
+typedef void (*alinked_task_fn)(void *arg);
+
+typedef struct
+{
+    alinked_task_fn fn;
+    void *arg;
+    uint64_t enqueued_ns;
+} alinked_task_t;
+
+DEFINE_ALINKED_NODE(alinked_task_t, executor_task);
+DEFINE_ALINKED_SYNC(alinked_task_t, executor_task);
+
+typedef struct
+{
+    size_t min_workers;
+    size_t max_workers;
+    size_t depth_per_worker;
+    uint64_t max_sojourn_ns;
+    uint64_t idle_ns;
+    size_t arena_len;
+    alinked_wait_strategy_t wait;
+} alinked_executor_config_t;
+
+typedef struct
+{
+    alinked_sync_executor_task_t queue;
+    alinked_executor_config_t config;
+    atomic_size_t workers;
+    atomic_size_t retiring;
+    atomic_bool running;
+    _Atomic uint64_t sojourn_ns;
+    atomic_size_t completed;
+} alinked_executor_t;
+
+static inline void alinked_executor_config_default(alinked_executor_config_t *config)
+{
+    config->min_workers = 1;
+    config->max_workers = 8;
+    config->depth_per_worker = 64;
+    config->max_sojourn_ns = 1000000;
+    config->idle_ns = 100000000;
+    config->arena_len = 512;
+    config->wait = ALINKED_WAIT_PARK;
+}
+
+static inline bool __fluent_libc_executor_retire(alinked_executor_t *executor)
+{
+    size_t workers = atomic_load(&executor->workers);
+    while (workers > executor->config.min_workers)
+    {
+        if (atomic_compare_exchange_weak(&executor->workers, &workers, workers - 1))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static inline bool __fluent_libc_executor_rejoin(alinked_executor_t *executor)
+{
+    size_t workers = atomic_load(&executor->workers);
+    while (workers < executor->config.max_workers)
+    {
+        if (atomic_compare_exchange_weak(&executor->workers, &workers, workers + 1))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static inline bool alinked_executor_run_one(alinked_executor_t *executor)
+{
+    alinked_task_t task;
+    if (!alinked_sync_executor_task_try_shift(&executor->queue, &task))
+    {
+        return false;
+    }
+
+    atomic_store_explicit(&executor->sojourn_ns, alinked_now_ns() - task.enqueued_ns, memory_order_relaxed);
+    task.fn(task.arg);
+    atomic_fetch_add_explicit(&executor->completed, 1, memory_order_relaxed);
+    return true;
+}
+
+static inline void *__fluent_libc_executor_worker(void *arg)
+{
+    alinked_executor_t *executor = (alinked_executor_t *)arg;
+    alinked_signal_t *signal = executor->queue.signal;
+    uint64_t idle_since = 0;
+    size_t spins = 0;
+
+    for (;;)
+    {
+        const unsigned epoch = alinked_signal_prepare(signal);
+        if (alinked_executor_run_one(executor))
+        {
+            idle_since = 0;
+            spins = 0;
+            continue;
+        }
+
+        if (!atomic_load(&executor->running))
+        {
+            break;
+        }
+
+        atomic_store_explicit(&executor->sojourn_ns, 0, memory_order_relaxed);
+        const uint64_t now = alinked_now_ns();
+        if (idle_since == 0)
+        {
+            idle_since = now;
+        }
+        else if (now - idle_since >= executor->config.idle_ns)
+        {
+            // retiring keeps destroy waiting while the queue is re-checked:
+            // a submit that saw this worker before it retired did not spawn,
+            // and the lock in len_exact orders this check after that append
+            atomic_fetch_add(&executor->retiring, 1);
+            const bool retired = __fluent_libc_executor_retire(executor);
+            const bool stranded = retired &&
+                alinked_sync_executor_task_len_exact(&executor->queue) > 0 &&
+                __fluent_libc_executor_rejoin(executor);
+            atomic_fetch_sub(&executor->retiring, 1);
+
+            if (retired && !stranded)
+            {
+                return NULL;
+            }
+
+            if (stranded)
+            {
+                idle_since = 0;
+                continue;
+            }
+        }
+
+        if (executor->config.wait == ALINKED_WAIT_PARK && spins >= ALINKED_WAIT_SPIN_LIMIT)
+        {
+            alinked_signal_park_for(signal, epoch, executor->config.idle_ns);
+            continue;
+        }
+
+        alinked_wait_signal(executor->config.wait, signal, epoch, &spins);
+    }
+
+    atomic_fetch_sub(&executor->workers, 1);
+    return NULL;
+}
+
+static inline bool __fluent_libc_executor_spawn(alinked_executor_t *executor)
+{
+    size_t workers = atomic_load(&executor->workers);
+    do
+    {
+        if (workers >= executor->config.max_workers)
+        {
+            return false;
+        }
+    } while (!atomic_compare_exchange_weak(&executor->workers, &workers, workers + 1));
+
+    pthread_t thread;
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+    const int failed = pthread_create(&thread, &attr, __fluent_libc_executor_worker, executor);
+    pthread_attr_destroy(&attr);
+
+    if (failed)
+    {
+        atomic_fetch_sub(&executor->workers, 1);
+        return false;
+    }
+
+    return true;
+}
+
+static inline void __fluent_libc_executor_scale(alinked_executor_t *executor)
+{
+    const size_t workers = atomic_load(&executor->workers);
+    const size_t depth = alinked_sync_executor_task_len(&executor->queue);
+    const uint64_t sojourn = atomic_load_explicit(&executor->sojourn_ns, memory_order_relaxed);
+
+    if (workers < executor->config.max_workers &&
+        (workers < executor->config.min_workers ||
+         (workers == 0 && depth > 0) ||
+         depth > executor->config.depth_per_worker * workers ||
+         sojourn > executor->config.max_sojourn_ns))
+    {
+        __fluent_libc_executor_spawn(executor);
+    }
+}
+
+static inline bool alinked_executor_init(
+    alinked_executor_t *executor,
+    const alinked_executor_config_t *config
+)
+{
+    executor->config = *config;
+    if (executor->config.max_workers == 0)
+    {
+        executor->config.max_workers = 1;
+    }
+
+    if (executor->config.min_workers > executor->config.max_workers)
+    {
+        executor->config.min_workers = executor->config.max_workers;
+    }
+
+    alinked_sync_executor_task_init(&executor->queue, executor->config.arena_len);
+    alinked_sync_executor_task_set_wait(&executor->queue, executor->config.wait);
+    atomic_init(&executor->workers, 0);
+    atomic_init(&executor->retiring, 0);
+    atomic_init(&executor->running, true);
+    atomic_init(&executor->sojourn_ns, 0);
+    atomic_init(&executor->completed, 0);
+
+    if (!executor->queue.queue.allocator)
+    {
+        return false;
+    }
+
+    const size_t initial = executor->config.min_workers ? executor->config.min_workers : 1;
+    for (size_t i = 0; i < initial; i++)
+    {
+        if (!__fluent_libc_executor_spawn(executor) && i == 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static inline bool alinked_executor_submit(
+    alinked_executor_t *executor,
+    const alinked_task_fn fn,
+    void *arg
+)
+{
+    const alinked_task_t task = { fn, arg, alinked_now_ns() };
+    const bool queued = alinked_sync_executor_task_append(&executor->queue, task);
+    __fluent_libc_executor_scale(executor);
+    return queued;
+}
+
+static inline size_t alinked_executor_submit_batch(
+    alinked_executor_t *executor,
+    alinked_task_t *tasks,
+    const size_t count
+)
+{
+    const uint64_t now = alinked_now_ns();
+    for (size_t i = 0; i < count; i++)
+    {
+        tasks[i].enqueued_ns = now;
+    }
+
+    const size_t queued = alinked_sync_executor_task_append_batch(&executor->queue, tasks, count);
+    __fluent_libc_executor_scale(executor);
+    return queued;
+}
+
+static inline size_t alinked_executor_workers(alinked_executor_t *executor)
+{
+    return atomic_load_explicit(&executor->workers, memory_order_relaxed);
+}
+
+static inline void alinked_executor_destroy(alinked_executor_t *executor)
+{
+    atomic_store(&executor->running, false);
+
+    while (atomic_load(&executor->workers) > 0 || atomic_load(&executor->retiring) > 0)
+    {
+        alinked_signal_broadcast(executor->queue.signal);
+
+        const struct timespec nap = { 0, 1000000 };
+        nanosleep(&nap, NULL);
+    }
+
+    alinked_sync_executor_task_destroy(&executor->queue);
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_EXECUTOR_LIBRARY_H
@@ -0,0 +1,402 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_HEAP_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_HEAP_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Arena-Backed Pairing Heap
+// ----------------------------------------
+// Mergeable priority queue built on the node pool of the linked queue: nodes
+// come from an `alinked_queue_heap_<name>_t` pool (arena plus free-list) and
+// are addressed by generational handles.
+//
+// Macro-powered & Type-safe:
+//   DEFINE_ALINKED_HEAP(T, name) – creates a heap type and API for type `T`.
+//
+// Heap Features:
+//   • O(1) insert and meld.
+//   • Amortized O(log n) pop (two-pass pairing).
+//   • decrease_key and erase through handles.
+//
+// API Usage:
+// ----------------------------------------
+//   DEFINE_ALINKED_HEAP(int, int);
+//   alinked_heap_int_t h;
+//   alinked_heap_int_init(&h, 512, cmp_int); // int cmp_int(int const *, int const *)
+//   alinked_heap_handle_int_t t = alinked_heap_int_insert(&h, 42);
+//   alinked_heap_int_decrease_key(&h, t, 7);
+//   int min = alinked_heap_int_pop(&h);
+//   alinked_heap_int_destroy(&h);
+//
+//   alinked_heap_int_set_budget(&h, &budget); // see alinked_budget.h, before inserting
+//   alinked_heap_int_t *pool[] = { &h };      // owner first, then shared heaps
+//   alinked_heap_int_memory(&m, pool, 1);
+//
+// Internals:
+//   - Each node is a queue node (`alinked_node_heap_<name>_t`) whose data is
+//     `struct { T value; child*; sibling*; prev* }`; `next` stays unused
+//   - `prev` is the parent for a first child, the left sibling otherwise
+//   - Allocation goes through the queue pool helpers, so fresh/reused
+//     counters, the memory budget and the flight recorder cover the heap
+//   - Heaps created with init_shared borrow the owner's pool, which is what
+//     allows meld without copying
+//
+// Notes:
+//   - Generic fallback for `void*` heap is provided as `alinked_heap_generic_t`
+//   - Non-thread safe by default (no locks)
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "alinked_queue.h"
+
+#define DEFINE_ALINKED_HEAP(V, NAME)                        \
+    typedef struct                                          \
+    {                                                       \
+        V value;                                            \
+        struct alinked_node_heap_##NAME##_t *child;         \
+        struct alinked_node_heap_##NAME##_t *sibling;       \
+        struct alinked_node_heap_##NAME##_t *prev;          \
+    } alinked_heap_entry_##NAME##_t;                        \
+                                                            \
+    DEFINE_ALINKED_NODE(alinked_heap_entry_##NAME##_t, heap_##NAME); \
+                                                            \
+    typedef alinked_node_heap_##NAME##_t alinked_heap_node_##NAME##_t; \
+                                                            \
+    typedef struct                                          \
+    {                                                       \
+        alinked_heap_node_##NAME##_t *node;                 \
+        uint32_t gen;                                       \
+    } alinked_heap_handle_##NAME##_t;                       \
+                                                            \
+    typedef struct                                          \
+    {                                                       \
+        alinked_heap_node_##NAME##_t *root;                 \
+        size_t len;                                         \
+        alinked_queue_heap_##NAME##_t pool;                 \
+        int (*cmp)(V const *, V const *);                   \
+    } alinked_heap_##NAME##_t;                              \
+                                                            \
+    static inline void alinked_heap_##NAME##_init(          \
+        alinked_heap_##NAME##_t *heap,                      \
+        const size_t arena_len,                             \
+        int (*cmp)(V const *, V const *)                    \
+    )                                                       \
+    {                                                       \
+        heap->root = NULL;                                  \
+        heap->len = 0;                                      \
+        heap->cmp = cmp;                                    \
+        alinked_queue_heap_##NAME##_init(&heap->pool, arena_len); \
+    }                                                       \
+                                                            \
+    static inline void alinked_heap_##NAME##_init_shared(   \
+        alinked_heap_##NAME##_t *heap,                      \
+        const alinked_heap_##NAME##_t *owner                \
+    )                                                       \
+    {                                                       \
+        heap->root = NULL;                                  \
+        heap->len = 0;                                      \
+        heap->cmp = owner->cmp;                             \
+        alinked_queue_heap_##NAME##_init_shared(&heap->pool, &owner->pool); \
+    }                                                       \
+                                                            \
+    static inline bool alinked_heap_##NAME##_set_budget(    \
+        alinked_heap_##NAME##_t *heap,                      \
+        alinked_budget_t *budget                            \
+    )                                                       \
+    {                                                       \
+        return alinked_queue_heap_##NAME##_set_budget(&heap->pool, budget); \
+    }                                                       \
+                                                            \
+    static inline void alinked_heap_##NAME##_destroy(       \
+        alinked_heap_##NAME##_t *heap                       \
+    )                                                       \
+    {                                                       \
+        alinked_queue_heap_##NAME##_destroy(&heap->pool);   \
+        heap->root = NULL;                                  \
+        heap->len = 0;                                      \
+    }                                                       \
+                                                            \
+    static inline void alinked_heap_##NAME##_memory(        \
+        alinked_memory_report_t *report,                    \
+        alinked_heap_##NAME##_t **heaps,                    \
+        const size_t count                                  \
+    )                                                       \
+    {                                                       \
+        size_t live = 0;                                    \
+                                                            \
+        report->fresh = 0;                                  \
+        report->reused = 0;                                 \
+        for (size_t i = 0; i < count; i++)                  \
+        {                                                   \
+            live += heaps[i]->len;                          \
+            report->fresh += heaps[i]->pool.fresh;          \
+            report->reused += heaps[i]->pool.reused;        \
+        }                                                   \
+                                                            \
+        const alinked_queue_heap_##NAME##_t *pool = count > 0 ? &heaps[0]->pool : NULL; \
+        const size_t free_nodes = pool && pool->free_list ? pool->free_list->length : 0; \
+        __fluent_libc_memory_report_fill(                   \
+            report,                                         \
+            sizeof(alinked_heap_node_##NAME##_t),           \
+            pool ? pool->arena_len : 0,                     \
+            live,                                           \
+            0,                                              \
+            free_nodes,                                     \
+            pool && pool->free_list                         \
+                ? sizeof(*pool->free_list) + pool->free_list->capacity * sizeof(alinked_heap_node_##NAME##_t *) \
+                : 0);                                       \
+    }                                                       \
+                                                            \
+    static inline alinked_heap_node_##NAME##_t *__fluent_libc_##NAME##_heap_link( \
+        const alinked_heap_##NAME##_t *heap,                \
+        alinked_heap_node_##NAME##_t *a,                    \
+        alinked_heap_node_##NAME##_t *b                     \
+    )                                                       \
+    {                                                       \
+        if (heap->cmp(&b->data.value, &a->data.value) < 0)  \
+        {                                                   \
+            alinked_heap_node_##NAME##_t *swap = a;         \
+            a = b;                                          \
+            b = swap;                                       \
+        }                                                   \
+                                                            \
+        b->data.sibling = a->data.child;                    \
+        if (a->data.child)                                  \
+        {                                                   \
+            a->data.child->data.prev = b;                   \
+        }                                                   \
+                                                            \
+        b->data.prev = a;                                   \
+        a->data.child = b;                                  \
+        a->data.sibling = NULL;                             \
+        a->data.prev = NULL;                                \
+        return a;                                           \
+    }                                                       \
+                                                            \
+    static inline alinked_heap_node_##NAME##_t *__fluent_libc_##NAME##_heap_merge_pairs( \
+        const alinked_heap_##NAME##_t *heap,                \
+        alinked_heap_node_##NAME##_t *first                 \
+    )                                                       \
+    {                                                       \
+        alinked_heap_node_##NAME##_t *pairs = NULL;         \
+        alinked_heap_node_##NAME##_t *result = NULL;        \
+                                                            \
+        while (first)                                       \
+        {                                                   \
+            alinked_heap_node_##NAME##_t *a = first;        \
+            alinked_heap_node_##NAME##_t *b = a->data.sibling; \
+            if (!b)                                         \
+            {                                               \
+                a->data.sibling = pairs;                    \
+                pairs = a;                                  \
+                break;                                      \
+            }                                               \
+                                                            \
+            first = b->data.sibling;                        \
+            a = __fluent_libc_##NAME##_heap_link(heap, a, b); \
+            a->data.sibling = pairs;                        \
+            pairs = a;                                      \
+        }                                                   \
+                                                            \
+        while (pairs)                                       \
+        {                                                   \
+            alinked_heap_node_##NAME##_t *next = pairs->data.sibling; \
+            pairs->data.sibling = NULL;                     \
+            pairs->data.prev = NULL;                        \
+            result = result ? __fluent_libc_##NAME##_heap_link(heap, result, pairs) : pairs; \
+            pairs = next;                                   \
+        }                                                   \
+                                                            \
+        return result;                                      \
+    }                                                       \
+                                                            \
+    static inline void __fluent_libc_##NAME##_heap_cut(     \
+        alinked_heap_node_##NAME##_t *node                  \
+    )                                                       \
+    {                                                       \
+        alinked_heap_node_##NAME##_t *prev = node->data.prev; \
+        if (prev->data.child == node)                       \
+        {                                                   \
+            prev->data.child = node->data.sibling;          \
+        }                                                   \
+        else                                                \
+        {                                                   \
+            prev->data.sibling = node->data.sibling;        \
+        }                                                   \
+                                                            \
+        if (node->data.sibling)                             \
+        {                                                   \
+            node->data.sibling->data.prev = prev;           \
+        }                                                   \
+                                                            \
+        node->data.sibling = NULL;                          \
+        node->data.prev = NULL;                             \
+    }                                                       \
+                                                            \
+    static inline alinked_heap_handle_##NAME##_t alinked_heap_##NAME##_insert( \
+        alinked_heap_##NAME##_t *heap,                      \
+        V data                                              \
+    )                                                       \
+    {                                                       \
+        alinked_heap_handle_##NAME##_t handle = { NULL, 0 }; \
+        alinked_heap_node_##NAME##_t *node = __fluent_libc_heap_##NAME##_linked_queue_suitable(&heap->pool); \
+        if (!node)                                          \
+        {                                                   \
+            return handle;                                  \
+        }                                                   \
+                                                            \
+        node->data.value = data;                            \
+        node->data.child = NULL;                            \
+        node->data.sibling = NULL;                          \
+        node->data.prev = NULL;                             \
+        node->next = NULL;                                  \
+                                                            \
+        heap->root = heap->root ? __fluent_libc_##NAME##_heap_link(heap, heap->root, node) : node; \
+        heap->len++;                                        \
+        ALINKED_RECORD(heap, ALINKED_OP_APPEND, heap->len,  \
+            node->gen == 1 ? ALINKED_SOURCE_ARENA : ALINKED_SOURCE_FREE_LIST); \
+                                                            \
+        handle.node = node;                                 \
+        handle.gen = node->gen;                             \
+        return handle;                                      \
+    }                                                       \
+                                                            \
+    static inline V *alinked_heap_##NAME##_peek(            \
+        const alinked_heap_##NAME##_t *heap                 \
+    )                                                       \
+    {                                                       \
+        return heap->root ? &heap->root->data.value : NULL; \
+    }                                                       \
+                                                            \
+    static inline V *alinked_heap_##NAME##_get(             \
+        const alinked_heap_handle_##NAME##_t handle         \
+    )                                                       \
+    {                                                       \
+        if (!handle.node || handle.node->gen != handle.gen) \
+        {                                                   \
+            return NULL;                                    \
+        }                                                   \
+                                                            \
+        return &handle.node->data.value;                    \
+    }                                                       \
+                                                            \
+    static inline V alinked_heap_##NAME##_pop(              \
+        alinked_heap_##NAME##_t *heap                       \
+    )                                                       \
+    {                                                       \
+        alinked_heap_node_##NAME##_t *node = heap->root;    \
+                                                            \
+        heap->root = __fluent_libc_##NAME##_heap_merge_pairs(heap, node->data.child); \
+        heap->len--;                                        \
+        ALINKED_RECORD(heap, ALINKED_OP_SHIFT, heap->len, ALINKED_SOURCE_NONE); \
+                                                            \
+        __fluent_libc_heap_##NAME##_linked_queue_recycle(&heap->pool, node); \
+        return node->data.value;                            \
+    }                                                       \
+                                                            \
+    static inline bool alinked_heap_##NAME##_decrease_key(  \
+        alinked_heap_##NAME##_t *heap,                      \
+        const alinked_heap_handle_##NAME##_t handle,        \
+        V data                                              \
+    )                                                       \
+    {                                                       \
+        alinked_heap_node_##NAME##_t *node = handle.node;   \
+        if (!node || node->gen != handle.gen || heap->cmp(&data, &node->data.value) > 0) \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        node->data.value = data;                            \
+        if (node != heap->root)                             \
+        {                                                   \
+            __fluent_libc_##NAME##_heap_cut(node);          \
+            heap->root = __fluent_libc_##NAME##_heap_link(heap, heap->root, node); \
+        }                                                   \
+                                                            \
+        return true;                                        \
+    }                                                       \
+                                                            \
+    static inline bool alinked_heap_##NAME##_erase(         \
+        alinked_heap_##NAME##_t *heap,                      \
+        const alinked_heap_handle_##NAME##_t handle         \
+    )                                                       \
+    {                                                       \
+        alinked_heap_node_##NAME##_t *node = handle.node;   \
+        if (!node || node->gen != handle.gen)               \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        if (node == heap->root)                             \
+        {                                                   \
+            (void)alinked_heap_##NAME##_pop(heap);          \
+            return true;                                    \
+        }                                                   \
+                                                            \
+        __fluent_libc_##NAME##_heap_cut(node);              \
+        alinked_heap_node_##NAME##_t *rest = __fluent_libc_##NAME##_heap_merge_pairs(heap, node->data.child); \
+        if (rest)                                           \
+        {                                                   \
+            heap->root = __fluent_libc_##NAME##_heap_link(heap, heap->root, rest); \
+        }                                                   \
+                                                            \
+        heap->len--;                                        \
+        ALINKED_RECORD(heap, ALINKED_OP_CANCEL, heap->len, ALINKED_SOURCE_NONE); \
+        __fluent_libc_heap_##NAME##_linked_queue_recycle(&heap->pool, node); \
+        return true;                                        \
+    }                                                       \
+                                                            \
+    static inline bool alinked_heap_##NAME##_meld(          \
+        alinked_heap_##NAME##_t *heap,                      \
+        alinked_heap_##NAME##_t *other                      \
+    )                                                       \
+    {                                                       \
+        if (heap->pool.allocator != other->pool.allocator)  \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        if (other->root)                                    \
+        {                                                   \
+            heap->root = heap->root                         \
+                ? __fluent_libc_##NAME##_heap_link(heap, heap->root, other->root) \
+                : other->root;                              \
+        }                                                   \
+                                                            \
+        heap->len += other->len;                            \
+        other->root = NULL;                                 \
+        other->len = 0;                                     \
+        ALINKED_RECORD(heap, ALINKED_OP_MERGE, heap->len, ALINKED_SOURCE_RELINK); \
+        return true;                                        \
+    }
+
+#ifndef FLUENT_LIBC_A_LINKED_HEAP_GENERIC_DEFINED
+    DEFINE_ALINKED_HEAP(void *, generic);
+#   define FLUENT_LIBC_A_LINKED_HEAP_GENERIC_DEFINED 1
+#endif
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_HEAP_LIBRARY_H
@@ -0,0 +1,522 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_MPSC_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_MPSC_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Multi-Producer Single-Consumer Linked Queue
+// ----------------------------------------
+// Intrusive MPSC queue (Vyukov style) on the arena nodes of
+// `alinked_queue_<name>_t`. Producers link with one atomic exchange on the
+// tail, the single consumer walks `next` pointers from a rotating dummy node.
+//
+// Macro-powered & Type-safe:
+//   DEFINE_ALINKED_MPSC(T, name) – creates an MPSC queue on the node type of
+//   DEFINE_ALINKED_NODE(T, name), which must come first.
+//
+// API Usage:
+// ----------------------------------------
+//   DEFINE_ALINKED_MPSC(void *, generic);
+//   alinked_mpsc_generic_t q;
+//   alinked_mpsc_generic_init(&q, 512);
+//   alinked_mpsc_generic_push(&q, msg);      // any thread
+//
+//   alinked_mpsc_producer_generic_t p;       // one per hot producing thread
+//   alinked_mpsc_generic_producer_init(&p, &q);
+//   alinked_mpsc_generic_producer_push(&p, msg); // no lock on the node path
+//   alinked_mpsc_generic_producer_release(&p);   // before the thread goes away
+//
+//   void *out;
+//   if (alinked_mpsc_generic_try_pop(&q, &out)) use(out); // one thread only
+//   size_t sent = alinked_mpsc_generic_push_batch(&q, items, n); // one exchange for n
+//   size_t got = alinked_mpsc_generic_pop_batch(&q, buf, 64);    // consumer only
+//   size_t depth = alinked_mpsc_generic_len_relaxed(&q); // cheap, approximate
+//   alinked_mpsc_generic_snapshot(&q, inspect, ctx);      // any thread, read-only
+//   alinked_mpsc_generic_destroy(&q);
+//
+// Internals:
+//   - The consumer never touches the node pool: it keeps the dummies it
+//     passes on a private chain and hands them back in batches of
+//     ALINKED_MPSC_RETURN through one atomic pointer (`returned`).
+//   - A producer handle takes the whole `returned` chain with one exchange
+//     and pops nodes from it privately; only when that is empty does it
+//     take `pool_lock` to carve up to ALINKED_MPSC_RETURN nodes at once.
+//     producer_release hands its leftovers back; a handle must not be used
+//     after the queue is destroyed (its nodes live in the queue's arena).
+//   - Plain `push` has no private cache: it pops one node under `pool_lock`
+//     (a handful of instructions) from a shared spare chain refilled the
+//     same way. Linking itself is lock-free on both paths.
+//   - try_pop may report empty for an instant while a producer sits between
+//     its exchange and its link store; `is_empty` already counts that item.
+//   - Producers count pushes in a striped counter (`alinked_counter.h`), so
+//     concurrent pushes never share a counter line, and the consumer owns the
+//     pop count; `len_exact` retries until it sees a stable push total.
+//     Defining ALINKED_MPSC_COMPACT keeps the push count in one word on the
+//     tail's cache line instead, which the tail exchange already owns: 512
+//     bytes less per queue, worth it for millions of per-actor mailboxes.
+//   - Snapshots announce themselves in `readers`; while one runs the consumer
+//     keeps passed dummies linked (`retired`) and recycles the whole run on
+//     the first pop that finds no reader, so a walker never lands on a node
+//     that went back to the pool.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <stdatomic.h>
+#include "alinked_queue.h"
+#include "alinked_wait.h"
+
+#ifndef ALINKED_MPSC_RETURN
+#   define ALINKED_MPSC_RETURN 32
+#endif
+
+static inline size_t __fluent_libc_mpsc_len_stable(
+    const atomic_size_t *pushed,
+    const atomic_size_t *popped
+)
+{
+    for (;;)
+    {
+        const size_t before = atomic_load_explicit(pushed, memory_order_seq_cst);
+        const size_t taken = atomic_load_explicit(popped, memory_order_seq_cst);
+        if (atomic_load_explicit(pushed, memory_order_seq_cst) == before)
+        {
+            return before > taken ? before - taken : 0;
+        }
+
+        alinked_cpu_relax();
+    }
+}
+
+#ifdef ALINKED_MPSC_COMPACT
+#   define ALINKED_MPSC_COUNTER atomic_size_t
+#   define ALINKED_MPSC_COUNT_INIT(counter) atomic_init(counter, 0)
+#   define ALINKED_MPSC_COUNT_ADD(counter, n) atomic_fetch_add_explicit(counter, n, memory_order_relaxed)
+#   define ALINKED_MPSC_COUNT_SUM(counter) atomic_load_explicit(counter, memory_order_relaxed)
+#   define ALINKED_MPSC_COUNT_STABLE(counter, popped) __fluent_libc_mpsc_len_stable(counter, popped)
+#else
+#   include "alinked_counter.h"
+#   define ALINKED_MPSC_COUNTER alinked_counter_t
+#   define ALINKED_MPSC_COUNT_INIT(counter) alinked_counter_init(counter)
+#   define ALINKED_MPSC_COUNT_ADD(counter, n) alinked_counter_add(counter, n)
+#   define ALINKED_MPSC_COUNT_SUM(counter) alinked_counter_sum(counter)
+#   define ALINKED_MPSC_COUNT_STABLE(counter, popped) alinked_counter_sum_stable(counter, popped)
+#endif
+
+#define DEFINE_ALINKED_MPSC(V, NAME)                        \
+    typedef struct                                          \
+    {                                                       \
+        _Alignas(ALINKED_CACHE_LINE) alinked_node_##NAME##_t *tail; \
+        ALINKED_MPSC_COUNTER pushed;                        \
+        _Alignas(ALINKED_CACHE_LINE) alinked_node_##NAME##_t *head; \
+        alinked_node_##NAME##_t *retired;                   \
+        alinked_node_##NAME##_t *unused;                    \
+        alinked_node_##NAME##_t *unused_last;               \
+        size_t unused_count;                                \
+        atomic_size_t popped;                               \
+        _Alignas(ALINKED_CACHE_LINE) atomic_uint readers;   \
+        _Alignas(ALINKED_CACHE_LINE) alinked_node_##NAME##_t *returned; \
+        _Alignas(ALINKED_CACHE_LINE) alinked_spinlock_t pool_lock; \
+        alinked_node_##NAME##_t *spare;                     \
+        alinked_queue_##NAME##_t pool;                      \
+    } alinked_mpsc_##NAME##_t;                              \
+                                                            \
+    typedef struct                                          \
+    {                                                       \
+        alinked_mpsc_##NAME##_t *mpsc;                      \
+        alinked_node_##NAME##_t *spare;                     \
+    } alinked_mpsc_producer_##NAME##_t;                     \
+                                                            \
+    static inline void alinked_mpsc_##NAME##_init(          \
+        alinked_mpsc_##NAME##_t *mpsc,                      \
+        const size_t arena_len                              \
+    )                                                       \
+    {                                                       \
+        alinked_spinlock_init(&mpsc->pool_lock);            \
+        alinked_queue_##NAME##_init(&mpsc->pool, arena_len); \
+        ALINKED_MPSC_COUNT_INIT(&mpsc->pushed);             \
+        atomic_init(&mpsc->popped, 0);                      \
+        atomic_init(&mpsc->readers, 0);                     \
+        mpsc->retired = NULL;                               \
+        mpsc->unused = NULL;                                \
+        mpsc->unused_last = NULL;                           \
+        mpsc->unused_count = 0;                             \
+        mpsc->returned = NULL;                              \
+        mpsc->spare = NULL;                                 \
+        mpsc->head = NULL;                                  \
+        mpsc->tail = NULL;                                  \
+                                                            \
+        if (!mpsc->pool.allocator)                          \
+        {                                                   \
+            return;                                         \
+        }                                                   \
+                                                            \
+        alinked_node_##NAME##_t *stub = __fluent_libc_##NAME##_linked_queue_suitable(&mpsc->pool); \
+        if (stub)                                           \
+        {                                                   \
+            stub->next = NULL;                              \
+            mpsc->head = stub;                              \
+            mpsc->tail = stub;                              \
+        }                                                   \
+    }                                                       \
+                                                            \
+    static inline void alinked_mpsc_##NAME##_destroy(       \
+        alinked_mpsc_##NAME##_t *mpsc                       \
+    )                                                       \
+    {                                                       \
+        alinked_queue_##NAME##_destroy(&mpsc->pool);        \
+        mpsc->head = NULL;                                  \
+        mpsc->tail = NULL;                                  \
+        mpsc->retired = NULL;                               \
+        mpsc->unused = NULL;                                \
+        mpsc->unused_last = NULL;                           \
+        mpsc->unused_count = 0;                             \
+        mpsc->returned = NULL;                              \
+        mpsc->spare = NULL;                                 \
+        ALINKED_MPSC_COUNT_INIT(&mpsc->pushed);             \
+        atomic_store(&mpsc->popped, 0);                     \
+    }                                                       \
+                                                            \
+    static inline void __fluent_libc_##NAME##_mpsc_give(    \
+        alinked_mpsc_##NAME##_t *mpsc,                      \
+        alinked_node_##NAME##_t *first,                     \
+        alinked_node_##NAME##_t *last                       \
+    )                                                       \
+    {                                                       \
+        alinked_node_##NAME##_t *top = __atomic_load_n(&mpsc->returned, __ATOMIC_RELAXED); \
+        do                                                  \
+        {                                                   \
+            last->next = top;                               \
+        } while (!__atomic_compare_exchange_n(&mpsc->returned, &top, first, true, \
+            __ATOMIC_RELEASE, __ATOMIC_RELAXED));           \
+    }                                                       \
+                                                            \
+    static inline void __fluent_libc_##NAME##_mpsc_retire(  \
+        alinked_mpsc_##NAME##_t *mpsc,                      \
+        alinked_node_##NAME##_t *node                       \
+    )                                                       \
+    {                                                       \
+        node->next = mpsc->unused;                          \
+        if (!mpsc->unused)                                  \
+        {                                                   \
+            mpsc->unused_last = node;                       \
+        }                                                   \
+                                                            \
+        mpsc->unused = node;                                \
+        if (++mpsc->unused_count < ALINKED_MPSC_RETURN)     \
+        {                                                   \
+            return;                                         \
+        }                                                   \
+                                                            \
+        __fluent_libc_##NAME##_mpsc_give(mpsc, mpsc->unused, mpsc->unused_last); \
+        mpsc->unused = NULL;                                \
+        mpsc->unused_last = NULL;                           \
+        mpsc->unused_count = 0;                             \
+    }                                                       \
+                                                            \
+    static inline alinked_node_##NAME##_t *__fluent_libc_##NAME##_mpsc_carve( \
+        alinked_mpsc_##NAME##_t *mpsc,                      \
+        const size_t count                                  \
+    )                                                       \
+    {                                                       \
+        alinked_node_##NAME##_t *chain = NULL;              \
+        alinked_spinlock_lock(&mpsc->pool_lock);            \
+        for (size_t i = 0; i < count; i++)                  \
+        {                                                   \
+            alinked_node_##NAME##_t *node = __fluent_libc_##NAME##_linked_queue_suitable(&mpsc->pool); \
+            if (!node)                                      \
+            {                                               \
+                break;                                      \
+            }                                               \
+                                                            \
+            node->next = chain;                             \
+            chain = node;                                   \
+        }                                                   \
+        alinked_spinlock_unlock(&mpsc->pool_lock);          \
+        return chain;                                       \
+    }                                                       \
+                                                            \
+    static inline void __fluent_libc_##NAME##_mpsc_link(    \
+        alinked_mpsc_##NAME##_t *mpsc,                      \
+        alinked_node_##NAME##_t *node,                      \
+        V data                                              \
+    )                                                       \
+    {                                                       \
+        node->data = data;                                  \
+        node->next = NULL;                                  \
+        ALINKED_MPSC_COUNT_ADD(&mpsc->pushed, 1);           \
+                                                            \
+        alinked_node_##NAME##_t *prev = __atomic_exchange_n(&mpsc->tail, node, __ATOMIC_SEQ_CST); \
+        __atomic_store_n(&prev->next, node, __ATOMIC_RELEASE); \
+    }                                                       \
+                                                            \
+    static inline alinked_node_##NAME##_t *__fluent_libc_##NAME##_mpsc_take( \
+        alinked_mpsc_##NAME##_t *mpsc                       \
+    )                                                       \
+    {                                                       \
+        if (!mpsc->spare)                                   \
+        {                                                   \
+            mpsc->spare = __atomic_exchange_n(&mpsc->returned, NULL, __ATOMIC_ACQUIRE); \
+        }                                                   \
+                                                            \
+        alinked_node_##NAME##_t *node = mpsc->spare;        \
+        if (!node)                                          \
+        {                                                   \
+            return __fluent_libc_##NAME##_linked_queue_suitable(&mpsc->pool); \
+        }                                                   \
+                                                            \
+        mpsc->spare = node->next;                           \
+        return node;                                        \
+    }                                                       \
+                                                            \
+    static inline bool alinked_mpsc_##NAME##_push(          \
+        alinked_mpsc_##NAME##_t *mpsc,                      \
+        V data                                              \
+    )                                                       \
+    {                                                       \
+        alinked_spinlock_lock(&mpsc->pool_lock);            \
+        alinked_node_##NAME##_t *node = __fluent_libc_##NAME##_mpsc_take(mpsc); \
+        alinked_spinlock_unlock(&mpsc->pool_lock);          \
+                                                            \
+        if (!node)                                          \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        __fluent_libc_##NAME##_mpsc_link(mpsc, node, data); \
+        return true;                                        \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_mpsc_##NAME##_push_batch(  \
+        alinked_mpsc_##NAME##_t *mpsc,                      \
+        V const *items,                                     \
+        const size_t count                                  \
+    )                                                       \
+    {                                                       \
+        alinked_node_##NAME##_t *chain = NULL;              \
+        alinked_node_##NAME##_t *last = NULL;               \
+        size_t linked = 0;                                  \
+                                                            \
+        alinked_spinlock_lock(&mpsc->pool_lock);            \
+        while (linked < count)                              \
+        {                                                   \
+            alinked_node_##NAME##_t *node = __fluent_libc_##NAME##_mpsc_take(mpsc); \
+            if (!node)                                      \
+            {                                               \
+                break;                                      \
+            }                                               \
+                                                            \
+            node->data = items[linked++];                   \
+            node->next = NULL;                              \
+            if (last)                                       \
+            {                                               \
+                last->next = node;                          \
+            }                                               \
+            else                                            \
+            {                                               \
+                chain = node;                               \
+            }                                               \
+                                                            \
+            last = node;                                    \
+        }                                                   \
+        alinked_spinlock_unlock(&mpsc->pool_lock);          \
+                                                            \
+        if (chain)                                          \
+        {                                                   \
+            ALINKED_MPSC_COUNT_ADD(&mpsc->pushed, linked);  \
+            alinked_node_##NAME##_t *prev = __atomic_exchange_n(&mpsc->tail, last, __ATOMIC_SEQ_CST); \
+            __atomic_store_n(&prev->next, chain, __ATOMIC_RELEASE); \
+        }                                                   \
+                                                            \
+        return linked;                                      \
+    }                                                       \
+                                                            \
+    static inline void alinked_mpsc_##NAME##_producer_init( \
+        alinked_mpsc_producer_##NAME##_t *producer,         \
+        alinked_mpsc_##NAME##_t *mpsc                       \
+    )                                                       \
+    {                                                       \
+        producer->mpsc = mpsc;                              \
+        producer->spare = NULL;                             \
+    }                                                       \
+                                                            \
+    static inline bool alinked_mpsc_##NAME##_producer_push( \
+        alinked_mpsc_producer_##NAME##_t *producer,         \
+        V data                                              \
+    )                                                       \
+    {                                                       \
+        alinked_mpsc_##NAME##_t *mpsc = producer->mpsc;     \
+        if (!producer->spare)                               \
+        {                                                   \
+            producer->spare = __atomic_exchange_n(&mpsc->returned, NULL, __ATOMIC_ACQUIRE); \
+        }                                                   \
+                                                            \
+        if (!producer->spare)                               \
+        {                                                   \
+            producer->spare = __fluent_libc_##NAME##_mpsc_carve(mpsc, ALINKED_MPSC_RETURN); \
+            if (!producer->spare)                           \
+            {                                               \
+                return false;                               \
+            }                                               \
+        }                                                   \
+                                                            \
+        alinked_node_##NAME##_t *node = producer->spare;    \
+        producer->spare = node->next;                       \
+        __fluent_libc_##NAME##_mpsc_link(mpsc, node, data); \
+        return true;                                        \
+    }                                                       \
+                                                            \
+    static inline void alinked_mpsc_##NAME##_producer_release( \
+        alinked_mpsc_producer_##NAME##_t *producer          \
+    )                                                       \
+    {                                                       \
+        alinked_node_##NAME##_t *last = producer->spare;    \
+        if (!last)                                          \
+        {                                                   \
+            return;                                         \
+        }                                                   \
+                                                            \
+        while (last->next)                                  \
+        {                                                   \
+            last = last->next;                              \
+        }                                                   \
+                                                            \
+        __fluent_libc_##NAME##_mpsc_give(producer->mpsc, producer->spare, last); \
+        producer->spare = NULL;                             \
+    }                                                       \
+                                                            \
+    static inline bool alinked_mpsc_##NAME##_try_pop(       \
+        alinked_mpsc_##NAME##_t *mpsc,                      \
+        V *out                                              \
+    )                                                       \
+    {                                                       \
+        alinked_node_##NAME##_t *dummy = mpsc->head;        \
+        alinked_node_##NAME##_t *next = __atomic_load_n(&dummy->next, __ATOMIC_ACQUIRE); \
+        if (!next)                                          \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        *out = next->data;                                  \
+        __atomic_store_n(&mpsc->head, next, __ATOMIC_SEQ_CST); \
+        atomic_store_explicit(&mpsc->popped,                \
+            atomic_load_explicit(&mpsc->popped, memory_order_relaxed) + 1, \
+            memory_order_relaxed);                          \
+                                                            \
+        if (atomic_load(&mpsc->readers) != 0)               \
+        {                                                   \
+            if (!mpsc->retired)                             \
+            {                                               \
+                mpsc->retired = dummy;                      \
+            }                                               \
+                                                            \
+            return true;                                    \
+        }                                                   \
+                                                            \
+        alinked_node_##NAME##_t *node = mpsc->retired ? mpsc->retired : dummy; \
+        mpsc->retired = NULL;                               \
+                                                            \
+        while (node != next)                                \
+        {                                                   \
+            alinked_node_##NAME##_t *after = node->next;    \
+            __fluent_libc_##NAME##_mpsc_retire(mpsc, node); \
+            node = after;                                   \
+        }                                                   \
+                                                            \
+        return true;                                        \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_mpsc_##NAME##_pop_batch(   \
+        alinked_mpsc_##NAME##_t *mpsc,                      \
+        V *out,                                             \
+        const size_t max                                    \
+    )                                                       \
+    {                                                       \
+        size_t count = 0;                                   \
+        while (count < max && alinked_mpsc_##NAME##_try_pop(mpsc, &out[count])) \
+        {                                                   \
+            count++;                                        \
+        }                                                   \
+                                                            \
+        return count;                                       \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_mpsc_##NAME##_snapshot(    \
+        alinked_mpsc_##NAME##_t *mpsc,                      \
+        void (*fn)(V const *, void *),                      \
+        void *ctx                                           \
+    )                                                       \
+    {                                                       \
+        atomic_fetch_add(&mpsc->readers, 1);                \
+        alinked_node_##NAME##_t *node = __atomic_load_n(&mpsc->head, __ATOMIC_SEQ_CST); \
+        alinked_node_##NAME##_t *last = __atomic_load_n(&mpsc->tail, __ATOMIC_ACQUIRE); \
+        size_t count = 0;                                   \
+                                                            \
+        while (node != last)                                \
+        {                                                   \
+            alinked_node_##NAME##_t *next = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE); \
+            if (!next)                                      \
+            {                                               \
+                break;                                      \
+            }                                               \
+                                                            \
+            fn(&next->data, ctx);                           \
+            node = next;                                    \
+            count++;                                        \
+        }                                                   \
+                                                            \
+        atomic_fetch_sub(&mpsc->readers, 1);                \
+        return count;                                       \
+    }                                                       \
+                                                            \
+    static inline bool alinked_mpsc_##NAME##_is_empty(      \
+        alinked_mpsc_##NAME##_t *mpsc                       \
+    )                                                       \
+    {                                                       \
+        return __atomic_load_n(&mpsc->tail, __ATOMIC_SEQ_CST) == __atomic_load_n(&mpsc->head, __ATOMIC_RELAXED); \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_mpsc_##NAME##_len_relaxed( \
+        alinked_mpsc_##NAME##_t *mpsc                       \
+    )                                                       \
+    {                                                       \
+        const size_t popped = atomic_load_explicit(&mpsc->popped, memory_order_relaxed); \
+        const size_t pushed = ALINKED_MPSC_COUNT_SUM(&mpsc->pushed); \
+        return pushed > popped ? pushed - popped : 0;       \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_mpsc_##NAME##_len_exact(   \
+        alinked_mpsc_##NAME##_t *mpsc                       \
+    )                                                       \
+    {                                                       \
+        return ALINKED_MPSC_COUNT_STABLE(&mpsc->pushed, &mpsc->popped); \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_mpsc_##NAME##_len(         \
+        alinked_mpsc_##NAME##_t *mpsc                       \
+    )                                                       \
+    {                                                       \
+        return alinked_mpsc_##NAME##_len_relaxed(mpsc);     \
+    }
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_MPSC_LIBRARY_H
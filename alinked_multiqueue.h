@@ -0,0 +1,301 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_MULTIQUEUE_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_MULTIQUEUE_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Relaxed Concurrent Priority Scheduler (MultiQueue)
+// ----------------------------------------
+// c·T sequential pairing heaps (see `alinked_heap.h`), each guarded by a
+// try-lock. Insert goes to a random heap, delete-min peeks the cached minimum
+// of two random heaps and pops from the better one. Throughput scales with the
+// thread count in exchange for a bounded rank error: the popped item is among
+// the O(c·T) smallest, not necessarily the smallest.
+//
+// Macro-powered & Type-safe:
+//   DEFINE_ALINKED_MULTIQUEUE(T, name) – creates a scheduler keyed by `uint64_t`
+//   priorities carrying payloads of type `T`.
+//
+// API Usage:
+// ----------------------------------------
+//   DEFINE_ALINKED_MULTIQUEUE(task_t *, task);
+//   alinked_multiqueue_task_t mq;
+//   if (!alinked_multiqueue_task_init(&mq, 64, 2, 512)) fail(); // 64 threads, c = 2
+//   alinked_multiqueue_task_insert(&mq, deadline, task);
+//
+//   uint64_t key;
+//   task_t *next;
+//   if (alinked_multiqueue_task_delete_min(&mq, &key, &next)) run(next);
+//   alinked_multiqueue_task_destroy(&mq);
+//
+// Notes:
+//   - Lower keys come out first; every uint64_t key is valid.
+//   - Each heap publishes its length next to its minimum key, so emptiness
+//     never depends on a sentinel key.
+//   - delete_min returns false only after observing every heap empty.
+//   - After a failed init, insert and delete_min return false.
+//   - Every heap has its own pool; set_budget charges them all to one
+//     budget (call it before the first insert) and memory sums their
+//     reports. memory reads the heaps unlocked: call it while idle.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "alinked_heap.h"
+#include "alinked_wait.h"
+
+static inline uint64_t alinked_random(void)
+{
+    static _Thread_local uint64_t state = 0;
+    if (state == 0)
+    {
+        state = (uint64_t)(uintptr_t)&state ^ 0x9E3779B97F4A7C15ull;
+    }
+
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+#define DEFINE_ALINKED_MULTIQUEUE(V, NAME)                  \
+    typedef struct                                          \
+    {                                                       \
+        uint64_t key;                                       \
+        V value;                                            \
+    } alinked_mq_item_##NAME##_t;                           \
+                                                            \
+    DEFINE_ALINKED_HEAP(alinked_mq_item_##NAME##_t, mq_##NAME); \
+                                                            \
+    typedef struct                                          \
+    {                                                       \
+        _Alignas(ALINKED_CACHE_LINE) atomic_flag lock;      \
+        _Atomic uint64_t top;                               \
+        atomic_size_t len;                                  \
+        alinked_heap_mq_##NAME##_t heap;                    \
+    } alinked_multiqueue_slot_##NAME##_t;                   \
+                                                            \
+    typedef struct                                          \
+    {                                                       \
+        alinked_multiqueue_slot_##NAME##_t *slots;          \
+        size_t count;                                       \
+    } alinked_multiqueue_##NAME##_t;                        \
+                                                            \
+    static inline int __fluent_libc_##NAME##_multiqueue_cmp( \
+        alinked_mq_item_##NAME##_t const *a,                \
+        alinked_mq_item_##NAME##_t const *b                 \
+    )                                                       \
+    {                                                       \
+        return (a->key > b->key) - (a->key < b->key);       \
+    }                                                       \
+                                                            \
+    static inline bool alinked_multiqueue_##NAME##_init(    \
+        alinked_multiqueue_##NAME##_t *mq,                  \
+        const size_t threads,                               \
+        const size_t factor,                                \
+        const size_t arena_len                              \
+    )                                                       \
+    {                                                       \
+        size_t count = threads * factor;                    \
+        if (count < 2)                                      \
+        {                                                   \
+            count = 2;                                      \
+        }                                                   \
+                                                            \
+        mq->count = 0;                                      \
+        mq->slots = (alinked_multiqueue_slot_##NAME##_t *)aligned_alloc( \
+            ALINKED_CACHE_LINE, count * sizeof(alinked_multiqueue_slot_##NAME##_t)); \
+        if (!mq->slots)                                     \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        for (size_t i = 0; i < count; i++)                  \
+        {                                                   \
+            atomic_flag_clear(&mq->slots[i].lock);          \
+            atomic_init(&mq->slots[i].top, UINT64_MAX);     \
+            atomic_init(&mq->slots[i].len, 0);              \
+            alinked_heap_mq_##NAME##_init(&mq->slots[i].heap, arena_len, \
+                __fluent_libc_##NAME##_multiqueue_cmp);     \
+        }                                                   \
+                                                            \
+        mq->count = count;                                  \
+        return true;                                        \
+    }                                                       \
+                                                            \
+    static inline void alinked_multiqueue_##NAME##_destroy( \
+        alinked_multiqueue_##NAME##_t *mq                   \
+    )                                                       \
+    {                                                       \
+        for (size_t i = 0; i < mq->count; i++)              \
+        {                                                   \
+            alinked_heap_mq_##NAME##_destroy(&mq->slots[i].heap); \
+        }                                                   \
+                                                            \
+        free(mq->slots);                                    \
+        mq->slots = NULL;                                   \
+        mq->count = 0;                                      \
+    }                                                       \
+                                                            \
+    static inline bool alinked_multiqueue_##NAME##_set_budget( \
+        alinked_multiqueue_##NAME##_t *mq,                  \
+        alinked_budget_t *budget                            \
+    )                                                       \
+    {                                                       \
+        bool ok = true;                                     \
+        for (size_t i = 0; i < mq->count; i++)              \
+        {                                                   \
+            ok = alinked_heap_mq_##NAME##_set_budget(&mq->slots[i].heap, budget) && ok; \
+        }                                                   \
+                                                            \
+        return ok;                                          \
+    }                                                       \
+                                                            \
+    static inline void alinked_multiqueue_##NAME##_memory(  \
+        alinked_memory_report_t *report,                    \
+        alinked_multiqueue_##NAME##_t *mq                   \
+    )                                                       \
+    {                                                       \
+        memset(report, 0, sizeof(*report));                 \
+        for (size_t i = 0; i < mq->count; i++)              \
+        {                                                   \
+            alinked_memory_report_t slot;                   \
+            alinked_heap_mq_##NAME##_t *heap = &mq->slots[i].heap; \
+            alinked_heap_mq_##NAME##_memory(&slot, &heap, 1); \
+            alinked_memory_report_add(report, &slot);       \
+        }                                                   \
+    }                                                       \
+                                                            \
+    static inline void __fluent_libc_##NAME##_multiqueue_publish( \
+        alinked_multiqueue_slot_##NAME##_t *slot            \
+    )                                                       \
+    {                                                       \
+        const alinked_mq_item_##NAME##_t *top = alinked_heap_mq_##NAME##_peek(&slot->heap); \
+        atomic_store_explicit(&slot->top, top ? top->key : UINT64_MAX, memory_order_relaxed); \
+        atomic_store_explicit(&slot->len, slot->heap.len, memory_order_relaxed); \
+        atomic_flag_clear_explicit(&slot->lock, memory_order_release); \
+    }                                                       \
+                                                            \
+    static inline bool alinked_multiqueue_##NAME##_insert(  \
+        alinked_multiqueue_##NAME##_t *mq,                  \
+        const uint64_t key,                                 \
+        V value                                             \
+    )                                                       \
+    {                                                       \
+        const alinked_mq_item_##NAME##_t item = { key, value }; \
+        if (mq->count == 0)                                 \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        for (;;)                                            \
+        {                                                   \
+            alinked_multiqueue_slot_##NAME##_t *slot = &mq->slots[alinked_random() % mq->count]; \
+            if (atomic_flag_test_and_set_explicit(&slot->lock, memory_order_acquire)) \
+            {                                               \
+                alinked_cpu_relax();                        \
+                continue;                                   \
+            }                                               \
+                                                            \
+            const bool ok = alinked_heap_mq_##NAME##_insert(&slot->heap, item).node != NULL; \
+            __fluent_libc_##NAME##_multiqueue_publish(slot); \
+            return ok;                                      \
+        }                                                   \
+    }                                                       \
+                                                            \
+    static inline bool __fluent_libc_##NAME##_multiqueue_all_empty( \
+        const alinked_multiqueue_##NAME##_t *mq             \
+    )                                                       \
+    {                                                       \
+        for (size_t i = 0; i < mq->count; i++)              \
+        {                                                   \
+            if (atomic_load_explicit(&mq->slots[i].len, memory_order_relaxed) != 0) \
+            {                                               \
+                return false;                               \
+            }                                               \
+        }                                                   \
+                                                            \
+        return true;                                        \
+    }                                                       \
+                                                            \
+    static inline bool alinked_multiqueue_##NAME##_delete_min( \
+        alinked_multiqueue_##NAME##_t *mq,                  \
+        uint64_t *key,                                      \
+        V *value                                            \
+    )                                                       \
+    {                                                       \
+        if (mq->count == 0)                                 \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        for (;;)                                            \
+        {                                                   \
+            alinked_multiqueue_slot_##NAME##_t *a = &mq->slots[alinked_random() % mq->count]; \
+            alinked_multiqueue_slot_##NAME##_t *b = &mq->slots[alinked_random() % mq->count]; \
+            const bool has_a = atomic_load_explicit(&a->len, memory_order_relaxed) != 0; \
+            const bool has_b = atomic_load_explicit(&b->len, memory_order_relaxed) != 0; \
+            alinked_multiqueue_slot_##NAME##_t *best = has_a ? a : b; \
+                                                            \
+            if (has_a && has_b &&                           \
+                atomic_load_explicit(&b->top, memory_order_relaxed) < atomic_load_explicit(&a->top, memory_order_relaxed)) \
+            {                                               \
+                best = b;                                   \
+            }                                               \
+                                                            \
+            if (!has_a && !has_b)                           \
+            {                                               \
+                if (__fluent_libc_##NAME##_multiqueue_all_empty(mq)) \
+                {                                           \
+                    return false;                           \
+                }                                           \
+                                                            \
+                continue;                                   \
+            }                                               \
+                                                            \
+            if (atomic_flag_test_and_set_explicit(&best->lock, memory_order_acquire)) \
+            {                                               \
+                alinked_cpu_relax();                        \
+                continue;                                   \
+            }                                               \
+                                                            \
+            if (best->heap.len == 0)                        \
+            {                                               \
+                __fluent_libc_##NAME##_multiqueue_publish(best); \
+                continue;                                   \
+            }                                               \
+                                                            \
+            const alinked_mq_item_##NAME##_t item = alinked_heap_mq_##NAME##_pop(&best->heap); \
+            __fluent_libc_##NAME##_multiqueue_publish(best); \
+                                                            \
+            *key = item.key;                                \
+            *value = item.value;                            \
+            return true;                                    \
+        }                                                   \
+    }
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_MULTIQUEUE_LIBRARY_H
@@ -0,0 +1,183 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_PARALLEL_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_PARALLEL_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Parallel Queue Traversal
+// ----------------------------------------
+// Visits every pending item of an `alinked_queue_<name>_t` on the workers of
+// an `alinked_executor_t`. One pre-walk cuts the chain into contiguous ranges
+// of equal node count; every range but the last becomes an executor task,
+// the caller takes the last and then helps run tasks until all are done.
+// Links, order and length of the queue are left untouched.
+//
+// Macro-powered & Type-safe:
+//   DEFINE_ALINKED_PARALLEL(T, name) – adds parallel_for_each to the queue of
+//   DEFINE_ALINKED_NODE(T, name), which must come first.
+//
+// API Usage:
+// ----------------------------------------
+//   DEFINE_ALINKED_NODE(order_t, order);
+//   DEFINE_ALINKED_PARALLEL(order_t, order);
+//   alinked_queue_order_parallel_for_each(&q, &ex, rescore, &model, 8);
+//   // void rescore(order_t *item, void *ctx), ex: see alinked_executor.h
+//
+// Notes:
+//   - `fn` may modify the item in place but must not touch the queue.
+//   - Ranges shorter than ALINKED_PARALLEL_MIN_RANGE nodes are not worth a
+//     task; small queues, or a NULL executor, are walked on the caller only.
+//   - No thread is created per call: the executor's pool is reused, and the
+//     caller helps drain it while waiting, so calling from inside a task on
+//     a saturated executor still finishes.
+//   - Cancelled items (tombstones) are skipped.
+//   - A range the executor cannot queue (allocation failure) runs on the
+//     caller instead, so the call never waits on work that was dropped.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "alinked_executor.h"
+#include "alinked_queue.h"
+#include "alinked_wait.h"
+
+#ifndef ALINKED_PARALLEL_MIN_RANGE
+#   define ALINKED_PARALLEL_MIN_RANGE 4096
+#endif
+
+#define DEFINE_ALINKED_PARALLEL(V, NAME)                    \
+    typedef struct                                          \
+    {                                                       \
+        alinked_node_##NAME##_t *first;                     \
+        size_t count;                                       \
+        void (*fn)(V *, void *);                            \
+        void *ctx;                                          \
+        atomic_size_t *remaining;                           \
+    } alinked_range_##NAME##_t;                             \
+                                                            \
+    static inline void __fluent_libc_##NAME##_parallel_run(void *arg) \
+    {                                                       \
+        alinked_range_##NAME##_t *range = (alinked_range_##NAME##_t *)arg; \
+        alinked_node_##NAME##_t *node = range->first;       \
+                                                            \
+        for (size_t i = 0; i < range->count; i++)           \
+        {                                                   \
+            if (node->gen & 1)                              \
+            {                                               \
+                range->fn(&node->data, range->ctx);         \
+            }                                               \
+                                                            \
+            node = node->next;                              \
+        }                                                   \
+                                                            \
+        if (range->remaining)                               \
+        {                                                   \
+            atomic_fetch_sub_explicit(range->remaining, 1, memory_order_release); \
+        }                                                   \
+    }                                                       \
+                                                            \
+    static inline bool alinked_queue_##NAME##_parallel_for_each( \
+        alinked_queue_##NAME##_t *queue,                    \
+        alinked_executor_t *executor,                       \
+        void (*fn)(V *, void *),                            \
+        void *ctx,                                          \
+        size_t parts                                        \
+    )                                                       \
+    {                                                       \
+        const size_t nodes = queue->len + queue->dead;      \
+        if (nodes == 0)                                     \
+        {                                                   \
+            return true;                                    \
+        }                                                   \
+                                                            \
+        if (parts > nodes / ALINKED_PARALLEL_MIN_RANGE)     \
+        {                                                   \
+            parts = nodes / ALINKED_PARALLEL_MIN_RANGE;     \
+        }                                                   \
+                                                            \
+        if (parts < 2 || !executor)                         \
+        {                                                   \
+            alinked_range_##NAME##_t whole;                 \
+            whole.first = queue->head;                      \
+            whole.count = nodes;                            \
+            whole.fn = fn;                                  \
+            whole.ctx = ctx;                                \
+            whole.remaining = NULL;                         \
+            __fluent_libc_##NAME##_parallel_run(&whole);    \
+            return true;                                    \
+        }                                                   \
+                                                            \
+        alinked_range_##NAME##_t *ranges = (alinked_range_##NAME##_t *)malloc(parts * sizeof(alinked_range_##NAME##_t)); \
+        if (!ranges)                                        \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        atomic_size_t remaining;                            \
+        atomic_init(&remaining, parts - 1);                 \
+                                                            \
+        alinked_node_##NAME##_t *node = queue->head;        \
+        const size_t share = nodes / parts;                 \
+        for (size_t i = 0; i < parts; i++)                  \
+        {                                                   \
+            ranges[i].first = node;                         \
+            ranges[i].count = i + 1 == parts ? nodes - share * i : share; \
+            ranges[i].fn = fn;                              \
+            ranges[i].ctx = ctx;                            \
+            ranges[i].remaining = i + 1 == parts ? NULL : &remaining; \
+                                                            \
+            if (i + 1 == parts)                             \
+            {                                               \
+                break;                                      \
+            }                                               \
+                                                            \
+            for (size_t j = 0; j < share; j++)              \
+            {                                               \
+                node = node->next;                          \
+            }                                               \
+                                                            \
+            if (!alinked_executor_submit(executor, __fluent_libc_##NAME##_parallel_run, &ranges[i])) \
+            {                                               \
+                __fluent_libc_##NAME##_parallel_run(&ranges[i]); \
+            }                                               \
+        }                                                   \
+                                                            \
+        __fluent_libc_##NAME##_parallel_run(&ranges[parts - 1]); \
+                                                            \
+        size_t spins = 0;                                   \
+        while (atomic_load_explicit(&remaining, memory_order_acquire) > 0) \
+        {                                                   \
+            if (!alinked_executor_run_one(executor))        \
+            {                                               \
+                alinked_wait_idle(ALINKED_WAIT_YIELD, &spins); \
+            }                                               \
+        }                                                   \
+                                                            \
+        free(ranges);                                       \
+        return true;                                        \
+    }
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_PARALLEL_LIBRARY_H
@@ -0,0 +1,415 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_PIPELINE_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_PIPELINE_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Staged Pipeline
+// ----------------------------------------
+// Chain of stages, one thread each (optionally pinned to a core), connected
+// by SPSC linked queues (`alinked_spsc.h`). Items travel in batches and every
+// stage keeps counters for throughput, input depth, busy and stall time.
+//
+// API Usage:
+// ----------------------------------------
+//   alinked_pipeline_t p;
+//   alinked_pipeline_init(&p, 64, ALINKED_WAIT_YIELD, 1024); // batch 64
+//   alinked_pipeline_add_stage(&p, "decode", decode, NULL, 2);  // pinned to cpu 2
+//   alinked_pipeline_add_stage(&p, "enrich", enrich, NULL, 3);
+//   alinked_pipeline_add_stage(&p, "persist", persist, db, -1); // not pinned
+//   alinked_pipeline_set_credits(&p, 4096); // optional: bound every input queue
+//   alinked_pipeline_start(&p);
+//
+//   alinked_pipeline_submit(&p, item); // from one feeding thread
+//
+//   alinked_stage_stats_t s;
+//   alinked_pipeline_stats(&p, 1, &s);
+//   alinked_pipeline_stop(&p);         // drains every stage, joins threads
+//   alinked_pipeline_destroy(&p);
+//
+// Notes:
+//   - A stage returns the item for the next stage, or NULL to drop it; what
+//     the last stage returns is discarded.
+//   - Stall time is wall time a stage spent finding its input empty, or
+//     backing off because the next input could not allocate a node.
+//   - Pinning uses sched_setaffinity and is ignored off Linux.
+//   - With credits set, each stage input holds at most that many items; the
+//     stage (or feeder) upstream of a full input blocks on `alinked_credit.h`
+//     and the stall shows up in its busy time.
+//   - submit_batch pushes at most `credits` items per call and returns how
+//     many went in; credit for items it could not push is handed back.
+//   - Credit pools are set up by add_stage and set_credits, so items may be
+//     submitted before start; call set_credits before submitting any.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include "alinked_credit.h"
+#include "alinked_queue.h"
+#include "alinked_spsc.h"
+#include "alinked_wait.h"
+
+#ifndef ALINKED_PIPELINE_MAX_STAGES
+#   define ALINKED_PIPELINE_MAX_STAGES 16
+#endif
+
+#ifndef ALINKED_PIPELINE_MAX_BATCH
+#   define ALINKED_PIPELINE_MAX_BATCH 256
+#endif
+
+DEFINE_ALINKED_NODE(void *, pipeline_item);
+DEFINE_ALINKED_SPSC(void *, pipeline_item);
+
+typedef void *(*alinked_stage_fn)(void *ctx, void *item);
+
+typedef struct alinked_pipeline_t alinked_pipeline_t;
+
+typedef struct
+{
+    alinked_spsc_pipeline_item_t input;
+    const char *name;
+    alinked_stage_fn fn;
+    void *ctx;
+    int cpu;
+    pthread_t thread;
+    alinked_pipeline_t *pipeline;
+    size_t index;
+    alinked_credit_t credit;
+    alinked_credit_producer_t sender;
+    alinked_credit_consumer_t receiver;
+    atomic_size_t processed;
+    _Atomic uint64_t busy_ns;
+    _Atomic uint64_t stall_ns;
+    atomic_bool done;
+} alinked_stage_t;
+
+typedef struct
+{
+    const char *name;
+    size_t processed;
+    size_t depth;
+    uint64_t busy_ns;
+    uint64_t stall_ns;
+    double items_per_sec;
+} alinked_stage_stats_t;
+
+struct alinked_pipeline_t
+{
+    alinked_stage_t stages[ALINKED_PIPELINE_MAX_STAGES];
+    size_t count;
+    size_t batch;
+    size_t arena_len;
+    size_t credits;
+    alinked_wait_strategy_t wait;
+    atomic_bool feeding_done;
+    uint64_t started_ns;
+};
+
+static inline void alinked_pipeline_init(
+    alinked_pipeline_t *pipeline,
+    const size_t batch,
+    const alinked_wait_strategy_t wait,
+    const size_t arena_len
+)
+{
+    pipeline->count = 0;
+    pipeline->batch = batch == 0 ? 1 : batch > ALINKED_PIPELINE_MAX_BATCH ? ALINKED_PIPELINE_MAX_BATCH : batch;
+    pipeline->arena_len = arena_len;
+    pipeline->credits = 0;
+    pipeline->wait = wait;
+    pipeline->started_ns = 0;
+    atomic_init(&pipeline->feeding_done, false);
+}
+
+static inline void __fluent_libc_pipeline_credit_init(
+    alinked_pipeline_t *pipeline,
+    alinked_stage_t *stage
+)
+{
+    alinked_credit_init(&stage->credit, pipeline->credits, pipeline->wait);
+    alinked_credit_producer_init(&stage->sender, &stage->credit, pipeline->batch);
+    alinked_credit_consumer_init(&stage->receiver, &stage->credit, pipeline->batch);
+}
+
+static inline size_t alinked_pipeline_add_stage(
+    alinked_pipeline_t *pipeline,
+    const char *name,
+    const alinked_stage_fn fn,
+    void *ctx,
+    const int cpu
+)
+{
+    if (pipeline->count == ALINKED_PIPELINE_MAX_STAGES)
+    {
+        return (size_t)-1;
+    }
+
+    alinked_stage_t *stage = &pipeline->stages[pipeline->count];
+    alinked_spsc_pipeline_item_init(&stage->input, pipeline->arena_len);
+    stage->name = name;
+    stage->fn = fn;
+    stage->ctx = ctx;
+    stage->cpu = cpu;
+    stage->pipeline = pipeline;
+    stage->index = pipeline->count;
+    atomic_init(&stage->processed, 0);
+    atomic_init(&stage->busy_ns, 0);
+    atomic_init(&stage->stall_ns, 0);
+    atomic_init(&stage->done, false);
+
+    __fluent_libc_pipeline_credit_init(pipeline, stage);
+    return pipeline->count++;
+}
+
+static inline void alinked_pipeline_set_credits(
+    alinked_pipeline_t *pipeline,
+    const size_t credits
+)
+{
+    // a stage pushes up to `batch` items at once and needs that much credit
+    pipeline->credits = credits && credits < pipeline->batch ? pipeline->batch : credits;
+
+    for (size_t i = 0; i < pipeline->count; i++)
+    {
+        __fluent_libc_pipeline_credit_init(pipeline, &pipeline->stages[i]);
+    }
+}
+
+static inline void __fluent_libc_pipeline_pin(const int cpu)
+{
+#if defined(__linux__)
+    unsigned long mask[1024 / (8 * sizeof(unsigned long))] = { 0 };
+    if (cpu < 0 || (size_t)cpu >= 8 * sizeof(mask))
+    {
+        return;
+    }
+
+    mask[(size_t)cpu / (8 * sizeof(unsigned long))] |= 1ul << ((size_t)cpu % (8 * sizeof(unsigned long)));
+    syscall(SYS_sched_setaffinity, 0, sizeof(mask), mask);
+#else
+    (void)cpu;
+#endif
+}
+
+static inline bool __fluent_libc_pipeline_upstream_done(const alinked_stage_t *stage)
+{
+    const alinked_pipeline_t *pipeline = stage->pipeline;
+    return stage->index == 0
+        ? atomic_load(&pipeline->feeding_done)
+        : atomic_load(&pipeline->stages[stage->index - 1].done);
+}
+
+static inline void *__fluent_libc_pipeline_stage_main(void *arg)
+{
+    alinked_stage_t *stage = (alinked_stage_t *)arg;
+    alinked_pipeline_t *pipeline = stage->pipeline;
+    alinked_stage_t *next = stage->index + 1 < pipeline->count ? &pipeline->stages[stage->index + 1] : NULL;
+    void *items[ALINKED_PIPELINE_MAX_BATCH];
+    size_t spins = 0;
+    uint64_t stalled_at = 0;
+
+    __fluent_libc_pipeline_pin(stage->cpu);
+
+    for (;;)
+    {
+        const bool upstream_done = __fluent_libc_pipeline_upstream_done(stage);
+        const size_t count = alinked_spsc_pipeline_item_pop_batch(&stage->input, items, pipeline->batch);
+
+        if (count == 0)
+        {
+            if (pipeline->credits)
+            {
+                alinked_credit_flush(&stage->receiver);
+            }
+
+            if (upstream_done)
+            {
+                break;
+            }
+
+            if (stalled_at == 0)
+            {
+                stalled_at = alinked_now_ns();
+            }
+
+            alinked_wait_idle(pipeline->wait, &spins);
+            continue;
+        }
+
+        if (pipeline->credits)
+        {
+            alinked_credit_grant(&stage->receiver, count);
+        }
+
+        const uint64_t start = alinked_now_ns();
+        uint64_t blocked = 0;
+        if (stalled_at != 0)
+        {
+            atomic_fetch_add_explicit(&stage->stall_ns, start - stalled_at, memory_order_relaxed);
+            stalled_at = 0;
+        }
+
+        size_t kept = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            void *out = stage->fn(stage->ctx, items[i]);
+            if (out)
+            {
+                items[kept++] = out;
+            }
+        }
+
+        if (next && kept > 0)
+        {
+            if (pipeline->credits)
+            {
+                alinked_credit_acquire(&next->sender, kept);
+            }
+
+            size_t pushed = alinked_spsc_pipeline_item_push_batch(&next->input, items, kept);
+            if (pushed < kept)
+            {
+                // out of nodes: back off until the next stage recycles some
+                const uint64_t blocked_at = alinked_now_ns();
+                size_t push_spins = 0;
+                while (pushed < kept)
+                {
+                    alinked_wait_idle(pipeline->wait, &push_spins);
+                    pushed += alinked_spsc_pipeline_item_push_batch(&next->input, items + pushed, kept - pushed);
+                }
+
+                blocked = alinked_now_ns() - blocked_at;
+                atomic_fetch_add_explicit(&stage->stall_ns, blocked, memory_order_relaxed);
+            }
+        }
+
+        atomic_fetch_add_explicit(&stage->busy_ns, alinked_now_ns() - start - blocked, memory_order_relaxed);
+        atomic_fetch_add_explicit(&stage->processed, count, memory_order_relaxed);
+        spins = 0;
+    }
+
+    atomic_store(&stage->done, true);
+    return NULL;
+}
+
+static inline bool alinked_pipeline_start(alinked_pipeline_t *pipeline)
+{
+    pipeline->started_ns = alinked_now_ns();
+
+    for (size_t i = 0; i < pipeline->count; i++)
+    {
+        alinked_stage_t *stage = &pipeline->stages[i];
+        if (!stage->input.head ||
+            pthread_create(&stage->thread, NULL, __fluent_libc_pipeline_stage_main, stage) != 0)
+        {
+            // let the stages that did start drain and exit
+            atomic_store(&pipeline->feeding_done, true);
+            for (size_t j = i; j < pipeline->count; j++)
+            {
+                atomic_store(&pipeline->stages[j].done, true);
+            }
+
+            for (size_t j = 0; j < i; j++)
+            {
+                pthread_join(pipeline->stages[j].thread, NULL);
+            }
+
+            pipeline->count = i;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static inline size_t alinked_pipeline_submit_batch(
+    alinked_pipeline_t *pipeline,
+    void **items,
+    const size_t count
+)
+{
+    alinked_stage_t *first = &pipeline->stages[0];
+    size_t take = count;
+
+    if (pipeline->credits)
+    {
+        // never ask for more than the input can hold
+        take = take < pipeline->credits ? take : pipeline->credits;
+        alinked_credit_acquire(&first->sender, take);
+    }
+
+    const size_t pushed = alinked_spsc_pipeline_item_push_batch(&first->input, items, take);
+    if (pipeline->credits && pushed < take)
+    {
+        alinked_credit_refund(&first->sender, take - pushed);
+    }
+
+    return pushed;
+}
+
+static inline bool alinked_pipeline_submit(alinked_pipeline_t *pipeline, void *item)
+{
+    return alinked_pipeline_submit_batch(pipeline, &item, 1) == 1;
+}
+
+static inline void alinked_pipeline_stats(
+    alinked_pipeline_t *pipeline,
+    const size_t index,
+    alinked_stage_stats_t *stats
+)
+{
+    alinked_stage_t *stage = &pipeline->stages[index];
+    const uint64_t elapsed = alinked_now_ns() - pipeline->started_ns;
+
+    stats->name = stage->name;
+    stats->processed = atomic_load_explicit(&stage->processed, memory_order_relaxed);
+    stats->depth = alinked_spsc_pipeline_item_len(&stage->input);
+    stats->busy_ns = atomic_load_explicit(&stage->busy_ns, memory_order_relaxed);
+    stats->stall_ns = atomic_load_explicit(&stage->stall_ns, memory_order_relaxed);
+    stats->items_per_sec = elapsed ? (double)stats->processed * 1e9 / (double)elapsed : 0.0;
+}
+
+static inline void alinked_pipeline_stop(alinked_pipeline_t *pipeline)
+{
+    atomic_store(&pipeline->feeding_done, true);
+
+    for (size_t i = 0; i < pipeline->count; i++)
+    {
+        pthread_join(pipeline->stages[i].thread, NULL);
+    }
+}
+
+static inline void alinked_pipeline_destroy(alinked_pipeline_t *pipeline)
+{
+    for (size_t i = 0; i < pipeline->count; i++)
+    {
+        alinked_spsc_pipeline_item_destroy(&pipeline->stages[i].input);
+    }
+
+    pipeline->count = 0;
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_PIPELINE_LIBRARY_H
@@ -25,6 +25,15 @@
 //   • Fast O(1) prepend, append, and shift operations.
 //   • Built-in arena allocator (chunk-based memory efficiency).
 //   • Optional free-list to reuse nodes (avoid arena fragmentation).
+//   • Lease mode: at-least-once shift with ack/nack and visibility timeout.
+//   • Generational handles for O(1) get/cancel of pending items.
+//   • In-place stable merge sort of the pending items (no allocation).
+//   • Pool sharing between queues, so nodes can be relinked across them.
+//   • K-way merge of sorted queues through a loser tree (one-shot or streaming).
+//   • Split at a position or in halves, and O(1) head-to-tail node transfer.
+//   • Memory report: live/tombstone/free-list/untouched bytes and reuse ratio.
+//   • Columnar drain: shift a batch straight into per-field arrays.
+//   • Optional byte budget shared with other queues (reject, block or spill).
 //
 // API Usage:
 // ----------------------------------------
@@ -35,10 +44,65 @@
 //   int x = alinked_queue_int_shift(&q);
 //   alinked_queue_int_destroy(&q);
 //
+//   alinked_queue_int_sort(&q, cmp_int); // int cmp_int(int const *, int const *)
+//
+//   // Queues sharing q's arena and free-list can exchange nodes
+//   alinked_queue_int_t a, b, out;
+//   alinked_queue_int_init_shared(&a, &q); // same for b and out
+//   alinked_queue_int_t *sources[] = { &a, &b };
+//   alinked_queue_int_merge(&out, sources, 2, cmp_int); // relinks, no copies
+//   alinked_queue_int_split_half(&a, &b);  // back half of a goes to b's tail
+//   alinked_queue_int_split_at(&a, 10, &b); // a keeps its first 10 items
+//   alinked_queue_int_transfer(&a, &b);    // a's head node becomes b's tail
+//
+//   // Columnar drain (struct tick_t { double px; uint32_t qty; })
+//   double px[256]; uint32_t qty[256];
+//   alinked_column_t cols[] = { ALINKED_COLUMN(tick_t, px, px), ALINKED_COLUMN(tick_t, qty, qty) };
+//   size_t rows = alinked_queue_tick_drain_columns(&ticks, cols, 2, 256);
+//
+//   alinked_budget_t budget; // needs ALINKED_MEMORY_BUDGET, see alinked_budget.h
+//   alinked_budget_init(&budget, 64u << 20, ALINKED_BUDGET_REJECT);
+//   alinked_queue_int_set_budget(&q, &budget); // past 64 MiB appends are dropped (NULL handle)
+//
+//   alinked_memory_report_t m;
+//   alinked_queue_int_t *pool[] = { &q, &a, &b, &out }; // owner first
+//   alinked_queue_int_memory(&m, pool, 4);
+//
+//   // Handles (safe after the node is recycled)
+//   alinked_handle_int_t p = alinked_queue_int_append_handle(&q, 7);
+//   int *pending = alinked_queue_int_get(p); // NULL once shifted/cancelled
+//   alinked_queue_int_cancel(&q, p);
+//
+//   // Lease mode (at-least-once delivery)
+//   alinked_lease_int_t l;
+//   alinked_lease_handle_int_t h; // distinct from queue handles
+//   alinked_lease_int_init(&l, &q, 500); // 500 ticks visibility timeout
+//   int y = alinked_lease_int_shift(&l, now, &h);
+//   alinked_lease_int_ack(&l, h);      // or nack, or let it expire:
+//   alinked_lease_int_expire(&l, now); // expired leases go back to the head
+//
 // Internals:
-//   - Each node is `struct { T data; next* }`
-//   - Queue stores head/tail/len + arena + free-list
+//   - Each node is `struct { T data; next*; gen; stamp }`
+//   - `gen` is odd while a node holds a live item, handles compare against it
+//   - Cancelled items stay linked as tombstones (`dead`) until shift reaches
+//     them; `len` only counts live items
+//   - In-flight leases are a FIFO ordered by deadline, ack/nack leave
+//     tombstones that are reaped once they reach its head; leases hand out
+//     `alinked_lease_handle_<name>_t`, so a leased node cannot be cancelled
+//     from the queue, nor a pending one acked
+//   - Queue stores head/tail/len + arena + free-list, plus plain counters
+//     (high watermark, items enqueued, nodes taken fresh from the arena)
 //   - Allocation done via arena_malloc or free-list reuse
+//   - The arena fills its chunks in order, so in the memory report only the
+//     newest chunk can be partly handed out (`last_chunk_nodes`); nodes the
+//     report cannot see in any listed queue (leases, dummies) are `held`
+//   - Defining ALINKED_FLIGHT_RECORDER records every operation into the
+//     per-thread ring of `alinked_recorder.h`
+//   - With ALINKED_MEMORY_BUDGET defined and a budget set, every node taken
+//     fresh from the arena is charged to the owner's account, which shared
+//     queues reach through `owner`; the owner's destroy returns it
+//   - Shared queues borrow the owner's arena/free-list and must be destroyed
+//     before it; only queues on the same pool may relink nodes
 //
 // Dependencies:
 //   - `arena.h` for memory pool
@@ -60,6 +124,9 @@ extern "C"
 #endif
 
 // ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
 #ifndef FLUENT_LIBC_RELEASE
 #   include <arena.h> // fluent_libc
 #   include <types.h> // fluent_libc
@@ -68,23 +135,171 @@ extern "C"
 #   include <fluent/vector/vector.h> // fluent_libc
 #   include <fluent/arena/arena.h> // fluent_libc
 #endif
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct alinked_budget_t alinked_budget_t;
+typedef struct alinked_budget_account_t alinked_budget_account_t;
+
+#ifdef ALINKED_FLIGHT_RECORDER
+#   include "alinked_recorder.h"
+#   define ALINKED_RECORD(queue, op, len, source) alinked_recorder_record(queue, op, len, source)
+#else
+#   define ALINKED_RECORD(queue, op, len, source) ((void)0)
+#endif
+
+#ifdef ALINKED_MEMORY_BUDGET
+#   include "alinked_budget.h"
+#   define ALINKED_BUDGET_SET(account, budget) alinked_budget_account_set(account, budget)
+#   define ALINKED_BUDGET_CHARGE(account, bytes) alinked_budget_account_charge(account, bytes)
+#   define ALINKED_BUDGET_REFUND(account, bytes) alinked_budget_account_refund(account, bytes)
+#   define ALINKED_BUDGET_CLOSE(account) alinked_budget_account_close(account)
+#else
+#   define ALINKED_BUDGET_SET(account, budget) ((void)(account), (void)(budget), false)
+#   define ALINKED_BUDGET_CHARGE(account, bytes) true
+#   define ALINKED_BUDGET_REFUND(account, bytes) ((void)0)
+#   define ALINKED_BUDGET_CLOSE(account) ((void)0)
+#endif
+
+typedef struct
+{
+    size_t node_bytes;
+    size_t arena_len;
+    size_t chunks;
+    size_t last_chunk_nodes;
+    size_t arena_bytes;
+    size_t live_bytes;
+    size_t dead_bytes;
+    size_t free_bytes;
+    size_t held_bytes;
+    size_t untouched_bytes;
+    size_t free_list_overhead_bytes;
+    size_t fresh;
+    size_t reused;
+    double reuse_ratio;
+} alinked_memory_report_t;
+
+static inline void __fluent_libc_memory_report_fill(
+    alinked_memory_report_t *report,
+    const size_t node,
+    size_t arena_len,
+    const size_t live,
+    const size_t dead,
+    const size_t free_nodes,
+    const size_t free_list_overhead
+)
+{
+    // expects report->fresh and report->reused summed over the pool's users
+    const size_t linked = live + dead + free_nodes;
+    arena_len = arena_len > 0 ? arena_len : 1;
+
+    report->node_bytes = node;
+    report->arena_len = arena_len;
+    report->chunks = (report->fresh + arena_len - 1) / arena_len;
+    report->last_chunk_nodes = report->fresh - (report->chunks > 0 ? (report->chunks - 1) * arena_len : 0);
+    report->arena_bytes = report->chunks * arena_len * node;
+    report->live_bytes = live * node;
+    report->dead_bytes = dead * node;
+    report->free_bytes = free_nodes * node;
+    report->held_bytes = report->fresh > linked ? (report->fresh - linked) * node : 0;
+    report->untouched_bytes = report->arena_bytes - report->fresh * node;
+    report->free_list_overhead_bytes = free_list_overhead;
+    report->reuse_ratio = report->fresh + report->reused > 0
+        ? (double)report->reused / (double)(report->fresh + report->reused)
+        : 0.0;
+}
+
+static inline void alinked_memory_report_add(
+    alinked_memory_report_t *total,
+    const alinked_memory_report_t *pool
+)
+{
+    // adds a separate pool (own arena) of the same node type into `total`
+    total->node_bytes = pool->node_bytes;
+    total->arena_len = pool->arena_len;
+    total->chunks += pool->chunks;
+    total->last_chunk_nodes += pool->last_chunk_nodes;
+    total->arena_bytes += pool->arena_bytes;
+    total->live_bytes += pool->live_bytes;
+    total->dead_bytes += pool->dead_bytes;
+    total->free_bytes += pool->free_bytes;
+    total->held_bytes += pool->held_bytes;
+    total->untouched_bytes += pool->untouched_bytes;
+    total->free_list_overhead_bytes += pool->free_list_overhead_bytes;
+    total->fresh += pool->fresh;
+    total->reused += pool->reused;
+    total->reuse_ratio = total->fresh + total->reused > 0
+        ? (double)total->reused / (double)(total->fresh + total->reused)
+        : 0.0;
+}
+
+typedef struct
+{
+    size_t offset;
+    size_t size;
+    void *dest;
+} alinked_column_t;
+
+#define ALINKED_COLUMN(T, FIELD, DEST) { offsetof(T, FIELD), sizeof(((T *)0)->FIELD), (DEST) }
+
+static inline void alinked_column_scatter(
+    const alinked_column_t *columns,
+    const size_t count,
+    const void *item,
+    const size_t row
+)
+{
+    for (size_t c = 0; c < count; c++)
+    {
+        const unsigned char *from = (const unsigned char *)item + columns[c].offset;
+        unsigned char *to = (unsigned char *)columns[c].dest + row * columns[c].size;
+
+        switch (columns[c].size)
+        {
+            case 1: *to = *from; break;
+            case 2: memcpy(to, from, 2); break;
+            case 4: memcpy(to, from, 4); break;
+            case 8: memcpy(to, from, 8); break;
+            default: memcpy(to, from, columns[c].size); break;
+        }
+    }
+}
 
 #define DEFINE_ALINKED_NODE(V, NAME)                        \
     typedef struct alinked_node_##NAME##_t                  \
     {                                                       \
         V data;                                             \
         struct alinked_node_##NAME##_t *next;               \
+        uint32_t gen;                                       \
+        uint32_t stamp;                                     \
     } alinked_node_##NAME##_t;                              \
                                                             \
+    typedef struct                                          \
+    {                                                       \
+        alinked_node_##NAME##_t *node;                      \
+        uint32_t gen;                                       \
+    } alinked_handle_##NAME##_t;                            \
+                                                            \
     DEFINE_VECTOR(alinked_node_##NAME##_t *, _fluent_libc_list_##NAME); \
                                                             \
-    typedef struct                                          \
+    typedef struct alinked_queue_##NAME##_t                 \
     {                                                       \
         alinked_node_##NAME##_t *head;                      \
         alinked_node_##NAME##_t *tail;                      \
         size_t len;                                         \
+        size_t dead;                                        \
+        size_t high;                                        \
+        size_t enqueued;                                    \
+        size_t fresh;                                       \
+        size_t reused;                                      \
+        size_t arena_len;                                   \
         arena_allocator_t *allocator;                       \
         vector__fluent_libc_list_##NAME##_t *free_list;     \
+        alinked_budget_account_t *budget;                   \
+        const struct alinked_queue_##NAME##_t *owner;       \
     } alinked_queue_##NAME##_t;                             \
                                                             \
     static inline void alinked_queue_##NAME##_init(         \
@@ -99,12 +314,29 @@ extern "C"
             queue->head = NULL;                             \
             queue->tail = NULL;                             \
             queue->len = 0;                                 \
+            queue->dead = 0;                                \
+            queue->high = 0;                                \
+            queue->enqueued = 0;                            \
+            queue->fresh = 0;                               \
+            queue->reused = 0;                              \
+            queue->arena_len = 0;                           \
+            queue->free_list = NULL;                        \
+            queue->budget = NULL;                           \
+            queue->owner = NULL;                            \
             return;                                         \
         }                                                   \
                                                             \
         queue->head = NULL;                                 \
         queue->tail = NULL;                                 \
         queue->len = 0;                                     \
+        queue->dead = 0;                                    \
+        queue->high = 0;                                    \
+        queue->enqueued = 0;                                \
+        queue->fresh = 0;                                   \
+        queue->reused = 0;                                  \
+        queue->arena_len = arena_len;                       \
+        queue->budget = NULL;                               \
+        queue->owner = NULL;                                \
                                                             \
         queue->free_list = malloc(sizeof(vector__fluent_libc_list_##NAME##_t)); \
         if (queue->free_list)                               \
@@ -117,10 +349,56 @@ extern "C"
         }                                                   \
     }                                                       \
                                                             \
+    static inline void alinked_queue_##NAME##_init_shared(  \
+        alinked_queue_##NAME##_t *queue,                    \
+        const alinked_queue_##NAME##_t *owner               \
+    )                                                       \
+    {                                                       \
+        queue->head = NULL;                                 \
+        queue->tail = NULL;                                 \
+        queue->len = 0;                                     \
+        queue->dead = 0;                                    \
+        queue->high = 0;                                    \
+        queue->enqueued = 0;                                \
+        queue->fresh = 0;                                   \
+        queue->reused = 0;                                  \
+        queue->arena_len = owner->arena_len;                \
+        queue->allocator = owner->allocator;                \
+        queue->free_list = owner->free_list;                \
+        queue->budget = NULL;                               \
+        queue->owner = owner;                               \
+    }                                                       \
+                                                            \
+    static inline bool alinked_queue_##NAME##_set_budget(   \
+        alinked_queue_##NAME##_t *queue,                    \
+        alinked_budget_t *budget                            \
+    )                                                       \
+    {                                                       \
+        if (queue->owner || !queue->allocator)              \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        return ALINKED_BUDGET_SET(&queue->budget, budget);  \
+    }                                                       \
+                                                            \
     static inline void alinked_queue_##NAME##_destroy(      \
         alinked_queue_##NAME##_t *queue                     \
     )                                                       \
     {                                                       \
+        if (queue->owner)                                   \
+        {                                                   \
+            queue->allocator = NULL;                        \
+            queue->free_list = NULL;                        \
+            queue->owner = NULL;                            \
+        }                                                   \
+                                                            \
+        if (queue->budget)                                  \
+        {                                                   \
+            ALINKED_BUDGET_CLOSE(queue->budget);            \
+            queue->budget = NULL;                           \
+        }                                                   \
+                                                            \
         if (queue->allocator)                               \
         {                                                   \
             destroy_arena(queue->allocator);                \
@@ -130,6 +408,9 @@ extern "C"
         queue->head = NULL;                                 \
         queue->tail = NULL;                                 \
         queue->len = 0;                                     \
+        queue->dead = 0;                                    \
+        queue->fresh = 0;                                   \
+        queue->reused = 0;                                  \
                                                             \
         if (queue->free_list)                               \
         {                                                   \
@@ -138,35 +419,93 @@ extern "C"
             queue->free_list = NULL;                        \
         }                                                   \
     }                                                       \
-    static alinked_node_##NAME##_t *__fluent_libc_##NAME##_linked_queue_suitable(const alinked_queue_##NAME##_t *queue) \
+    static alinked_node_##NAME##_t *__fluent_libc_##NAME##_linked_queue_suitable(alinked_queue_##NAME##_t *queue) \
     {                                                       \
         if (queue->free_list && queue->free_list->length > 0) \
         {                                                   \
             alinked_node_##NAME##_t *node = vec__fluent_libc_list_##NAME##_pop(queue->free_list); \
+            node->gen++;                                    \
+            queue->reused++;                                \
             return node;                                    \
         }                                                   \
                                                             \
+        alinked_budget_account_t *account = queue->owner ? queue->owner->budget : queue->budget; \
+        if (account && !ALINKED_BUDGET_CHARGE(account, sizeof(alinked_node_##NAME##_t))) \
+        {                                                   \
+            return NULL;                                    \
+        }                                                   \
+                                                            \
         alinked_node_##NAME##_t *node = (alinked_node_##NAME##_t *)arena_malloc(queue->allocator); \
         if (!node)                                          \
         {                                                   \
+            if (account)                                    \
+            {                                               \
+                ALINKED_BUDGET_REFUND(account, sizeof(alinked_node_##NAME##_t)); \
+            }                                               \
+                                                            \
             return NULL;                                    \
         }                                                   \
                                                             \
+        node->gen = 1;                                      \
+        queue->fresh++;                                     \
         return node;                                        \
     }                                                       \
                                                             \
-    static inline void alinked_queue_##NAME##_append(       \
+    static inline void __fluent_libc_##NAME##_linked_queue_reclaim( \
+        const alinked_queue_##NAME##_t *queue,              \
+        alinked_node_##NAME##_t *node                       \
+    )                                                       \
+    {                                                       \
+        if (queue->free_list)                               \
+        {                                                   \
+            vec__fluent_libc_list_##NAME##_push(queue->free_list, node); \
+        }                                                   \
+    }                                                       \
+                                                            \
+    static inline void __fluent_libc_##NAME##_linked_queue_recycle( \
+        const alinked_queue_##NAME##_t *queue,              \
+        alinked_node_##NAME##_t *node                       \
+    )                                                       \
+    {                                                       \
+        node->gen++;                                        \
+        __fluent_libc_##NAME##_linked_queue_reclaim(queue, node); \
+    }                                                       \
+                                                            \
+    static inline void __fluent_libc_##NAME##_linked_queue_grew( \
         alinked_queue_##NAME##_t *queue,                    \
-        V data                                              \
+        const size_t count                                  \
     )                                                       \
     {                                                       \
-        alinked_node_##NAME##_t *node = __fluent_libc_##NAME##_linked_queue_suitable(queue); \
-        if (!node)                                          \
+        queue->enqueued += count;                           \
+        if (queue->len > queue->high)                       \
         {                                                   \
-            return;                                         \
+            queue->high = queue->len;                       \
         }                                                   \
+    }                                                       \
                                                             \
-        node->data = data;                                  \
+    static inline void __fluent_libc_##NAME##_linked_queue_relink_head( \
+        alinked_queue_##NAME##_t *queue,                    \
+        alinked_node_##NAME##_t *first,                     \
+        alinked_node_##NAME##_t *last,                      \
+        const size_t count                                  \
+    )                                                       \
+    {                                                       \
+        last->next = queue->head;                           \
+        if (queue->len == 0)                                \
+        {                                                   \
+            queue->tail = last;                             \
+        }                                                   \
+                                                            \
+        queue->head = first;                                \
+        queue->len += count;                                \
+        __fluent_libc_##NAME##_linked_queue_grew(queue, count); \
+    }                                                       \
+                                                            \
+    static inline void __fluent_libc_##NAME##_linked_queue_link_tail( \
+        alinked_queue_##NAME##_t *queue,                    \
+        alinked_node_##NAME##_t *node                       \
+    )                                                       \
+    {                                                       \
         node->next = NULL;                                  \
                                                             \
         if (queue->len == 0)                                \
@@ -181,54 +520,766 @@ extern "C"
         }                                                   \
                                                             \
         queue->len++;                                       \
+        __fluent_libc_##NAME##_linked_queue_grew(queue, 1); \
     }                                                       \
                                                             \
-    static inline void alinked_queue_##NAME##_prepend(      \
+    static inline alinked_node_##NAME##_t *__fluent_libc_##NAME##_linked_queue_peek( \
+        alinked_queue_##NAME##_t *queue                     \
+    )                                                       \
+    {                                                       \
+        if (queue->len == 0)                                \
+        {                                                   \
+            return NULL;                                    \
+        }                                                   \
+                                                            \
+        while (!(queue->head->gen & 1))                     \
+        {                                                   \
+            alinked_node_##NAME##_t *node = queue->head;    \
+            queue->head = node->next;                       \
+            queue->dead--;                                  \
+            __fluent_libc_##NAME##_linked_queue_reclaim(queue, node); \
+        }                                                   \
+                                                            \
+        return queue->head;                                 \
+    }                                                       \
+                                                            \
+    static inline void __fluent_libc_##NAME##_linked_queue_drop_dead( \
+        alinked_queue_##NAME##_t *queue                     \
+    )                                                       \
+    {                                                       \
+        if (queue->len > 0)                                 \
+        {                                                   \
+            return;                                         \
+        }                                                   \
+                                                            \
+        while (queue->head)                                 \
+        {                                                   \
+            alinked_node_##NAME##_t *node = queue->head;    \
+            queue->head = node->next;                       \
+            __fluent_libc_##NAME##_linked_queue_reclaim(queue, node); \
+        }                                                   \
+                                                            \
+        queue->tail = NULL;                                 \
+        queue->dead = 0;                                    \
+    }                                                       \
+                                                            \
+    static inline alinked_node_##NAME##_t *__fluent_libc_##NAME##_linked_queue_detach_head( \
+        alinked_queue_##NAME##_t *queue                     \
+    )                                                       \
+    {                                                       \
+        alinked_node_##NAME##_t *node = __fluent_libc_##NAME##_linked_queue_peek(queue); \
+        queue->head = node->next;                           \
+        queue->len--;                                       \
+        __fluent_libc_##NAME##_linked_queue_drop_dead(queue); \
+        return node;                                        \
+    }                                                       \
+                                                            \
+    static inline alinked_handle_##NAME##_t alinked_queue_##NAME##_append_handle( \
         alinked_queue_##NAME##_t *queue,                    \
         V data                                              \
     )                                                       \
     {                                                       \
+        alinked_handle_##NAME##_t handle = { NULL, 0 };     \
         alinked_node_##NAME##_t *node = __fluent_libc_##NAME##_linked_queue_suitable(queue); \
         if (!node)                                          \
         {                                                   \
-            return;                                         \
+            return handle;                                  \
         }                                                   \
                                                             \
         node->data = data;                                  \
-        node->next = queue->head;                           \
+        __fluent_libc_##NAME##_linked_queue_link_tail(queue, node); \
+        ALINKED_RECORD(queue, ALINKED_OP_APPEND, queue->len, \
+            node->gen == 1 ? ALINKED_SOURCE_ARENA : ALINKED_SOURCE_FREE_LIST); \
+        handle.node = node;                                 \
+        handle.gen = node->gen;                             \
+        return handle;                                      \
+    }                                                       \
                                                             \
-        if (queue->len == 0)                                \
+    static inline alinked_handle_##NAME##_t alinked_queue_##NAME##_prepend_handle( \
+        alinked_queue_##NAME##_t *queue,                    \
+        V data                                              \
+    )                                                       \
+    {                                                       \
+        alinked_handle_##NAME##_t handle = { NULL, 0 };     \
+        alinked_node_##NAME##_t *node = __fluent_libc_##NAME##_linked_queue_suitable(queue); \
+        if (!node)                                          \
         {                                                   \
-            queue->tail = node;                             \
+            return handle;                                  \
         }                                                   \
                                                             \
-        queue->head = node;                                 \
-        queue->len++;                                       \
+        node->data = data;                                  \
+        __fluent_libc_##NAME##_linked_queue_relink_head(queue, node, node, 1); \
+        ALINKED_RECORD(queue, ALINKED_OP_PREPEND, queue->len, \
+            node->gen == 1 ? ALINKED_SOURCE_ARENA : ALINKED_SOURCE_FREE_LIST); \
+        handle.node = node;                                 \
+        handle.gen = node->gen;                             \
+        return handle;                                      \
+    }                                                       \
+                                                            \
+    static inline void alinked_queue_##NAME##_append(       \
+        alinked_queue_##NAME##_t *queue,                    \
+        V data                                              \
+    )                                                       \
+    {                                                       \
+        (void)alinked_queue_##NAME##_append_handle(queue, data); \
+    }                                                       \
+                                                            \
+    static inline void alinked_queue_##NAME##_prepend(      \
+        alinked_queue_##NAME##_t *queue,                    \
+        V data                                              \
+    )                                                       \
+    {                                                       \
+        (void)alinked_queue_##NAME##_prepend_handle(queue, data); \
     }                                                       \
                                                             \
     static inline V alinked_queue_##NAME##_shift(           \
         alinked_queue_##NAME##_t *queue                     \
     )                                                       \
     {                                                       \
-        alinked_node_##NAME##_t *node = queue->head;        \
+        alinked_node_##NAME##_t *node = __fluent_libc_##NAME##_linked_queue_detach_head(queue); \
+        __fluent_libc_##NAME##_linked_queue_recycle(queue, node); \
+        ALINKED_RECORD(queue, ALINKED_OP_SHIFT, queue->len, ALINKED_SOURCE_NONE); \
+        return node->data;                                  \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_queue_##NAME##_drain_columns( \
+        alinked_queue_##NAME##_t *queue,                    \
+        const alinked_column_t *columns,                    \
+        const size_t count,                                 \
+        const size_t max                                    \
+    )                                                       \
+    {                                                       \
+        size_t rows = 0;                                    \
+        while (rows < max && queue->len > 0)                \
+        {                                                   \
+            alinked_node_##NAME##_t *node = __fluent_libc_##NAME##_linked_queue_detach_head(queue); \
+            alinked_column_scatter(columns, count, &node->data, rows++); \
+            __fluent_libc_##NAME##_linked_queue_recycle(queue, node); \
+            ALINKED_RECORD(queue, ALINKED_OP_SHIFT, queue->len, ALINKED_SOURCE_NONE); \
+        }                                                   \
+                                                            \
+        return rows;                                        \
+    }                                                       \
+                                                            \
+    static inline V *alinked_queue_##NAME##_get(            \
+        const alinked_handle_##NAME##_t handle              \
+    )                                                       \
+    {                                                       \
+        if (!handle.node || handle.node->gen != handle.gen) \
+        {                                                   \
+            return NULL;                                    \
+        }                                                   \
+                                                            \
+        return &handle.node->data;                          \
+    }                                                       \
+                                                            \
+    static inline bool alinked_queue_##NAME##_cancel(       \
+        alinked_queue_##NAME##_t *queue,                    \
+        const alinked_handle_##NAME##_t handle              \
+    )                                                       \
+    {                                                       \
+        if (!handle.node || handle.node->gen != handle.gen) \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        handle.node->gen++;                                 \
+        queue->len--;                                       \
+        queue->dead++;                                      \
+        ALINKED_RECORD(queue, ALINKED_OP_CANCEL, queue->len, ALINKED_SOURCE_NONE); \
+        __fluent_libc_##NAME##_linked_queue_drop_dead(queue); \
+        return true;                                        \
+    }                                                       \
+                                                            \
+    static inline void __fluent_libc_##NAME##_linked_queue_compact( \
+        alinked_queue_##NAME##_t *queue                     \
+    )                                                       \
+    {                                                       \
+        alinked_node_##NAME##_t **link = &queue->head;      \
+        alinked_node_##NAME##_t *last = NULL;               \
+                                                            \
+        while (queue->dead > 0 && *link)                    \
+        {                                                   \
+            alinked_node_##NAME##_t *node = *link;          \
+            if (node->gen & 1)                              \
+            {                                               \
+                last = node;                                \
+                link = &node->next;                         \
+                continue;                                   \
+            }                                               \
+                                                            \
+            *link = node->next;                             \
+            queue->dead--;                                  \
+            __fluent_libc_##NAME##_linked_queue_reclaim(queue, node); \
+        }                                                   \
+                                                            \
+        if (!*link)                                         \
+        {                                                   \
+            queue->tail = last;                             \
+        }                                                   \
+    }                                                       \
+                                                            \
+    static inline void alinked_queue_##NAME##_sort(         \
+        alinked_queue_##NAME##_t *queue,                    \
+        int (*cmp)(V const *, V const *)                    \
+    )                                                       \
+    {                                                       \
+        __fluent_libc_##NAME##_linked_queue_compact(queue); \
+        if (queue->len < 2)                                 \
+        {                                                   \
+            return;                                         \
+        }                                                   \
+                                                            \
+        alinked_node_##NAME##_t *list = queue->head;        \
+        alinked_node_##NAME##_t *tail = NULL;               \
+        size_t width = 1;                                   \
+                                                            \
+        for (;;)                                            \
+        {                                                   \
+            alinked_node_##NAME##_t *left = list;           \
+            size_t merges = 0;                              \
+            list = NULL;                                    \
+            tail = NULL;                                    \
+                                                            \
+            while (left)                                    \
+            {                                               \
+                alinked_node_##NAME##_t *right = left;      \
+                size_t left_len = 0;                        \
+                size_t right_len = width;                   \
+                merges++;                                   \
+                                                            \
+                while (right && left_len < width)           \
+                {                                           \
+                    left_len++;                             \
+                    right = right->next;                    \
+                }                                           \
+                                                            \
+                while (left_len > 0 || (right_len > 0 && right)) \
+                {                                           \
+                    alinked_node_##NAME##_t *next;          \
+                    if (left_len == 0)                      \
+                    {                                       \
+                        next = right;                       \
+                        right = right->next;                \
+                        right_len--;                        \
+                    }                                       \
+                    else if (right_len == 0 || !right ||    \
+                        cmp(&left->data, &right->data) <= 0) \
+                    {                                       \
+                        next = left;                        \
+                        left = left->next;                  \
+                        left_len--;                         \
+                    }                                       \
+                    else                                    \
+                    {                                       \
+                        next = right;                       \
+                        right = right->next;                \
+                        right_len--;                        \
+                    }                                       \
+                                                            \
+                    if (tail)                               \
+                    {                                       \
+                        tail->next = next;                  \
+                    }                                       \
+                    else                                    \
+                    {                                       \
+                        list = next;                        \
+                    }                                       \
+                                                            \
+                    tail = next;                            \
+                }                                           \
+                                                            \
+                left = right;                               \
+            }                                               \
+                                                            \
+            tail->next = NULL;                              \
+            if (merges <= 1)                                \
+            {                                               \
+                break;                                      \
+            }                                               \
+                                                            \
+            width <<= 1;                                    \
+        }                                                   \
+                                                            \
+        queue->head = list;                                 \
+        queue->tail = tail;                                 \
+        ALINKED_RECORD(queue, ALINKED_OP_SORT, queue->len, ALINKED_SOURCE_RELINK); \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_queue_##NAME##_split_at(   \
+        alinked_queue_##NAME##_t *queue,                    \
+        const size_t n,                                     \
+        alinked_queue_##NAME##_t *out                       \
+    )                                                       \
+    {                                                       \
+        if (queue == out || queue->allocator != out->allocator) \
+        {                                                   \
+            return 0;                                       \
+        }                                                   \
                                                             \
-        if (queue->head == queue->tail)                     \
+        __fluent_libc_##NAME##_linked_queue_compact(queue); \
+        if (n >= queue->len)                                \
+        {                                                   \
+            return 0;                                       \
+        }                                                   \
+                                                            \
+        alinked_node_##NAME##_t *first = queue->head;       \
+        alinked_node_##NAME##_t *last = queue->tail;        \
+        const size_t moved = queue->len - n;                \
+                                                            \
+        if (n == 0)                                         \
         {                                                   \
             queue->head = NULL;                             \
             queue->tail = NULL;                             \
         }                                                   \
         else                                                \
         {                                                   \
-            queue->head = node->next;                       \
+            alinked_node_##NAME##_t *keep = queue->head;    \
+            for (size_t i = 1; i < n; i++)                  \
+            {                                               \
+                keep = keep->next;                          \
+            }                                               \
+                                                            \
+            first = keep->next;                             \
+            keep->next = NULL;                              \
+            queue->tail = keep;                             \
         }                                                   \
                                                             \
-        if (queue->free_list)                               \
+        queue->len = n;                                     \
+                                                            \
+        if (out->len == 0)                                  \
         {                                                   \
-            vec__fluent_libc_list_##NAME##_push(queue->free_list, node); \
+            out->head = first;                              \
+        }                                                   \
+        else                                                \
+        {                                                   \
+            out->tail->next = first;                        \
+        }                                                   \
+                                                            \
+        out->tail = last;                                   \
+        out->len += moved;                                  \
+        __fluent_libc_##NAME##_linked_queue_grew(out, moved); \
+        ALINKED_RECORD(queue, ALINKED_OP_SPLIT, queue->len, ALINKED_SOURCE_RELINK); \
+        return moved;                                       \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_queue_##NAME##_split_half( \
+        alinked_queue_##NAME##_t *queue,                    \
+        alinked_queue_##NAME##_t *out                       \
+    )                                                       \
+    {                                                       \
+        return alinked_queue_##NAME##_split_at(queue, (queue->len + 1) / 2, out); \
+    }                                                       \
+                                                            \
+    static inline bool alinked_queue_##NAME##_transfer(     \
+        alinked_queue_##NAME##_t *from,                     \
+        alinked_queue_##NAME##_t *to                        \
+    )                                                       \
+    {                                                       \
+        if (from->len == 0 || from->allocator != to->allocator) \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        alinked_node_##NAME##_t *node = __fluent_libc_##NAME##_linked_queue_detach_head(from); \
+        __fluent_libc_##NAME##_linked_queue_link_tail(to, node); \
+        ALINKED_RECORD(from, ALINKED_OP_TRANSFER, from->len, ALINKED_SOURCE_RELINK); \
+        return true;                                        \
+    }                                                       \
+                                                            \
+    static inline void alinked_queue_##NAME##_memory(       \
+        alinked_memory_report_t *report,                    \
+        alinked_queue_##NAME##_t **queues,                  \
+        const size_t count                                  \
+    )                                                       \
+    {                                                       \
+        const size_t node = sizeof(alinked_node_##NAME##_t); \
+        size_t live = 0;                                    \
+        size_t dead = 0;                                    \
+                                                            \
+        report->fresh = 0;                                  \
+        report->reused = 0;                                 \
+        for (size_t i = 0; i < count; i++)                  \
+        {                                                   \
+            live += queues[i]->len;                         \
+            dead += queues[i]->dead;                        \
+            report->fresh += queues[i]->fresh;              \
+            report->reused += queues[i]->reused;            \
+        }                                                   \
+                                                            \
+        const vector__fluent_libc_list_##NAME##_t *free_list = count > 0 ? queues[0]->free_list : NULL; \
+        __fluent_libc_memory_report_fill(                   \
+            report,                                         \
+            node,                                           \
+            count > 0 ? queues[0]->arena_len : 0,           \
+            live,                                           \
+            dead,                                           \
+            free_list ? free_list->length : 0,              \
+            free_list ? sizeof(*free_list) + free_list->capacity * sizeof(alinked_node_##NAME##_t *) : 0); \
+    }                                                       \
+                                                            \
+    typedef struct                                          \
+    {                                                       \
+        alinked_queue_##NAME##_t **inputs;                  \
+        size_t count;                                       \
+        size_t leaves;                                      \
+        size_t *tree;                                       \
+        int (*cmp)(V const *, V const *);                   \
+    } alinked_merger_##NAME##_t;                            \
+                                                            \
+    static inline bool __fluent_libc_##NAME##_merger_less(  \
+        const alinked_merger_##NAME##_t *merger,            \
+        const size_t a,                                     \
+        const size_t b                                      \
+    )                                                       \
+    {                                                       \
+        alinked_node_##NAME##_t *x = a < merger->count      \
+            ? __fluent_libc_##NAME##_linked_queue_peek(merger->inputs[a]) : NULL; \
+        alinked_node_##NAME##_t *y = b < merger->count      \
+            ? __fluent_libc_##NAME##_linked_queue_peek(merger->inputs[b]) : NULL; \
+                                                            \
+        if (!x || !y)                                       \
+        {                                                   \
+            return x != NULL;                               \
+        }                                                   \
+                                                            \
+        const int order = merger->cmp(&x->data, &y->data);  \
+        return order < 0 || (order == 0 && a < b);          \
+    }                                                       \
+                                                            \
+    static size_t __fluent_libc_##NAME##_merger_build(      \
+        alinked_merger_##NAME##_t *merger,                  \
+        const size_t at                                     \
+    )                                                       \
+    {                                                       \
+        if (at >= merger->leaves)                           \
+        {                                                   \
+            return at - merger->leaves;                     \
+        }                                                   \
+                                                            \
+        const size_t left = __fluent_libc_##NAME##_merger_build(merger, 2 * at); \
+        const size_t right = __fluent_libc_##NAME##_merger_build(merger, 2 * at + 1); \
+                                                            \
+        if (__fluent_libc_##NAME##_merger_less(merger, right, left)) \
+        {                                                   \
+            merger->tree[at] = left;                        \
+            return right;                                   \
+        }                                                   \
+                                                            \
+        merger->tree[at] = right;                           \
+        return left;                                        \
+    }                                                       \
+                                                            \
+    static inline void alinked_merger_##NAME##_rebuild(     \
+        alinked_merger_##NAME##_t *merger                   \
+    )                                                       \
+    {                                                       \
+        merger->tree[0] = __fluent_libc_##NAME##_merger_build(merger, 1); \
+    }                                                       \
+                                                            \
+    static inline bool alinked_merger_##NAME##_init(        \
+        alinked_merger_##NAME##_t *merger,                  \
+        alinked_queue_##NAME##_t **inputs,                  \
+        const size_t count,                                 \
+        int (*cmp)(V const *, V const *)                    \
+    )                                                       \
+    {                                                       \
+        size_t leaves = 1;                                  \
+        while (leaves < count)                              \
+        {                                                   \
+            leaves <<= 1;                                   \
+        }                                                   \
+                                                            \
+        merger->inputs = inputs;                            \
+        merger->count = count;                              \
+        merger->leaves = leaves;                            \
+        merger->cmp = cmp;                                  \
+        merger->tree = (size_t *)malloc(leaves * sizeof(size_t)); \
+        if (!merger->tree)                                  \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        alinked_merger_##NAME##_rebuild(merger);            \
+        return true;                                        \
+    }                                                       \
+                                                            \
+    static inline void alinked_merger_##NAME##_destroy(     \
+        alinked_merger_##NAME##_t *merger                   \
+    )                                                       \
+    {                                                       \
+        free(merger->tree);                                 \
+        merger->tree = NULL;                                \
+        merger->inputs = NULL;                              \
+        merger->count = 0;                                  \
+    }                                                       \
+                                                            \
+    static inline bool alinked_merger_##NAME##_next(        \
+        alinked_merger_##NAME##_t *merger,                  \
+        alinked_queue_##NAME##_t *out                       \
+    )                                                       \
+    {                                                       \
+        size_t winner = merger->tree[0];                    \
+        if (winner >= merger->count || merger->inputs[winner]->len == 0) \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        alinked_node_##NAME##_t *node = __fluent_libc_##NAME##_linked_queue_detach_head(merger->inputs[winner]); \
+        __fluent_libc_##NAME##_linked_queue_link_tail(out, node); \
+                                                            \
+        for (size_t at = (winner + merger->leaves) / 2; at > 0; at /= 2) \
+        {                                                   \
+            if (__fluent_libc_##NAME##_merger_less(merger, merger->tree[at], winner)) \
+            {                                               \
+                const size_t loser = winner;                \
+                winner = merger->tree[at];                  \
+                merger->tree[at] = loser;                   \
+            }                                               \
+        }                                                   \
+                                                            \
+        merger->tree[0] = winner;                           \
+        return true;                                        \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_merger_##NAME##_drain(     \
+        alinked_merger_##NAME##_t *merger,                  \
+        alinked_queue_##NAME##_t *out,                      \
+        const size_t max                                    \
+    )                                                       \
+    {                                                       \
+        size_t moved = 0;                                   \
+        while (moved < max && alinked_merger_##NAME##_next(merger, out)) \
+        {                                                   \
+            moved++;                                        \
+        }                                                   \
+                                                            \
+        if (moved > 0)                                      \
+        {                                                   \
+            ALINKED_RECORD(out, ALINKED_OP_MERGE, out->len, ALINKED_SOURCE_RELINK); \
+        }                                                   \
+                                                            \
+        return moved;                                       \
+    }                                                       \
+                                                            \
+    static inline bool alinked_queue_##NAME##_merge(        \
+        alinked_queue_##NAME##_t *out,                      \
+        alinked_queue_##NAME##_t **inputs,                  \
+        const size_t count,                                 \
+        int (*cmp)(V const *, V const *)                    \
+    )                                                       \
+    {                                                       \
+        alinked_merger_##NAME##_t merger;                   \
+        for (size_t i = 0; i < count; i++)                  \
+        {                                                   \
+            if (inputs[i]->allocator != out->allocator)     \
+            {                                               \
+                return false;                               \
+            }                                               \
+        }                                                   \
+                                                            \
+        if (!alinked_merger_##NAME##_init(&merger, inputs, count, cmp)) \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        alinked_merger_##NAME##_drain(&merger, out, (size_t)-1); \
+        alinked_merger_##NAME##_destroy(&merger);           \
+        return true;                                        \
+    }                                                       \
+                                                            \
+    typedef struct                                          \
+    {                                                       \
+        alinked_node_##NAME##_t *node;                      \
+        uint32_t gen;                                       \
+    } alinked_lease_handle_##NAME##_t;                      \
+                                                            \
+    typedef struct                                          \
+    {                                                       \
+        alinked_queue_##NAME##_t *queue;                    \
+        alinked_node_##NAME##_t *head;                      \
+        alinked_node_##NAME##_t *tail;                      \
+        size_t len;                                         \
+        uint32_t timeout;                                   \
+    } alinked_lease_##NAME##_t;                             \
+                                                            \
+    static inline void alinked_lease_##NAME##_init(         \
+        alinked_lease_##NAME##_t *lease,                    \
+        alinked_queue_##NAME##_t *queue,                    \
+        const uint32_t timeout                              \
+    )                                                       \
+    {                                                       \
+        lease->queue = queue;                               \
+        lease->head = NULL;                                 \
+        lease->tail = NULL;                                 \
+        lease->len = 0;                                     \
+        lease->timeout = timeout;                           \
+    }                                                       \
+                                                            \
+    static inline void alinked_lease_##NAME##_destroy(      \
+        alinked_lease_##NAME##_t *lease                     \
+    )                                                       \
+    {                                                       \
+        while (lease->head)                                 \
+        {                                                   \
+            alinked_node_##NAME##_t *node = lease->head;    \
+            lease->head = node->next;                       \
+            if (node->gen & 1)                              \
+            {                                               \
+                node->gen++;                                \
+            }                                               \
+                                                            \
+            __fluent_libc_##NAME##_linked_queue_reclaim(lease->queue, node); \
+        }                                                   \
+                                                            \
+        lease->tail = NULL;                                 \
+        lease->len = 0;                                     \
+    }                                                       \
+                                                            \
+    static inline void __fluent_libc_##NAME##_lease_reap(   \
+        alinked_lease_##NAME##_t *lease                     \
+    )                                                       \
+    {                                                       \
+        while (lease->head && !(lease->head->gen & 1))      \
+        {                                                   \
+            alinked_node_##NAME##_t *node = lease->head;    \
+            lease->head = node->next;                       \
+            __fluent_libc_##NAME##_linked_queue_reclaim(lease->queue, node); \
+        }                                                   \
+                                                            \
+        if (!lease->head)                                   \
+        {                                                   \
+            lease->tail = NULL;                             \
+        }                                                   \
+    }                                                       \
+                                                            \
+    static inline V alinked_lease_##NAME##_shift(           \
+        alinked_lease_##NAME##_t *lease,                    \
+        const uint32_t now,                                 \
+        alinked_lease_handle_##NAME##_t *handle             \
+    )                                                       \
+    {                                                       \
+        alinked_node_##NAME##_t *node = __fluent_libc_##NAME##_linked_queue_detach_head(lease->queue); \
+        node->gen += 2;                                     \
+        node->stamp = now + lease->timeout;                 \
+        node->next = NULL;                                  \
+                                                            \
+        if (lease->tail)                                    \
+        {                                                   \
+            lease->tail->next = node;                       \
+        }                                                   \
+        else                                                \
+        {                                                   \
+            lease->head = node;                             \
+        }                                                   \
+                                                            \
+        lease->tail = node;                                 \
+        lease->len++;                                       \
+        ALINKED_RECORD(lease->queue, ALINKED_OP_LEASE, lease->queue->len, ALINKED_SOURCE_RELINK); \
+                                                            \
+        if (handle)                                         \
+        {                                                   \
+            handle->node = node;                            \
+            handle->gen = node->gen;                        \
         }                                                   \
                                                             \
-        queue->len--;                                       \
         return node->data;                                  \
+    }                                                       \
+                                                            \
+    static inline bool alinked_lease_##NAME##_ack(          \
+        alinked_lease_##NAME##_t *lease,                    \
+        const alinked_lease_handle_##NAME##_t handle        \
+    )                                                       \
+    {                                                       \
+        if (!handle.node || handle.node->gen != handle.gen) \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        handle.node->gen++;                                 \
+        lease->len--;                                       \
+        __fluent_libc_##NAME##_lease_reap(lease);           \
+        ALINKED_RECORD(lease->queue, ALINKED_OP_ACK, lease->queue->len, ALINKED_SOURCE_NONE); \
+        return true;                                        \
+    }                                                       \
+                                                            \
+    static inline bool alinked_lease_##NAME##_nack(         \
+        alinked_lease_##NAME##_t *lease,                    \
+        const alinked_lease_handle_##NAME##_t handle        \
+    )                                                       \
+    {                                                       \
+        alinked_node_##NAME##_t *node = handle.node;        \
+        if (!node || node->gen != handle.gen)               \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        if (node == lease->head)                            \
+        {                                                   \
+            lease->head = node->next;                       \
+            node->gen += 2;                                 \
+            __fluent_libc_##NAME##_linked_queue_relink_head(lease->queue, node, node, 1); \
+            ALINKED_RECORD(lease->queue, ALINKED_OP_NACK, lease->queue->len, ALINKED_SOURCE_RELINK); \
+        }                                                   \
+        else                                                \
+        {                                                   \
+            alinked_node_##NAME##_t *copy = __fluent_libc_##NAME##_linked_queue_suitable(lease->queue); \
+            if (!copy)                                      \
+            {                                               \
+                return false;                               \
+            }                                               \
+                                                            \
+            copy->data = node->data;                        \
+            node->gen++;                                    \
+            __fluent_libc_##NAME##_linked_queue_relink_head(lease->queue, copy, copy, 1); \
+            ALINKED_RECORD(lease->queue, ALINKED_OP_NACK, lease->queue->len, \
+                copy->gen == 1 ? ALINKED_SOURCE_ARENA : ALINKED_SOURCE_FREE_LIST); \
+        }                                                   \
+                                                            \
+        lease->len--;                                       \
+        __fluent_libc_##NAME##_lease_reap(lease);           \
+        return true;                                        \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_lease_##NAME##_expire(     \
+        alinked_lease_##NAME##_t *lease,                    \
+        const uint32_t now                                  \
+    )                                                       \
+    {                                                       \
+        alinked_node_##NAME##_t *first = NULL;              \
+        alinked_node_##NAME##_t *last = NULL;               \
+        size_t count = 0;                                   \
+                                                            \
+        __fluent_libc_##NAME##_lease_reap(lease);           \
+        while (lease->head && (int32_t)(now - lease->head->stamp) >= 0) \
+        {                                                   \
+            alinked_node_##NAME##_t *node = lease->head;    \
+            lease->head = node->next;                       \
+            node->gen += 2;                                 \
+            node->next = NULL;                              \
+                                                            \
+            if (last)                                       \
+            {                                               \
+                last->next = node;                          \
+            }                                               \
+            else                                            \
+            {                                               \
+                first = node;                               \
+            }                                               \
+                                                            \
+            last = node;                                    \
+            count++;                                        \
+            lease->len--;                                   \
+            __fluent_libc_##NAME##_lease_reap(lease);       \
+        }                                                   \
+                                                            \
+        if (count > 0)                                      \
+        {                                                   \
+            __fluent_libc_##NAME##_linked_queue_relink_head(lease->queue, first, last, count); \
+            ALINKED_RECORD(lease->queue, ALINKED_OP_EXPIRE, lease->queue->len, ALINKED_SOURCE_RELINK); \
+        }                                                   \
+                                                            \
+        return count;                                       \
     }
 
 #ifndef FLUENT_LIBC_A_LINKED_QUEUE_GENERIC_DEFINED
@@ -0,0 +1,360 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_RECORDER_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_RECORDER_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Flight Recorder
+// ----------------------------------------
+// Per-thread ring of the most recent queue operations for post-mortem
+// analysis. Building with `ALINKED_FLIGHT_RECORDER` defined makes every
+// queue record its append/prepend/shift/cancel/split/transfer/sort/merge
+// calls and its leases' shift/ack/nack/expire; without it the hooks compile
+// to nothing.
+//
+// API Usage:
+// ----------------------------------------
+//   // cc -DALINKED_FLIGHT_RECORDER ...
+//   alinked_recorder_install_crash_handler(); // dump to stderr on SIGSEGV & co.
+//   ...
+//   alinked_recorder_dump(STDERR_FILENO);     // also fine from a signal handler
+//
+// Event Layout (16 bytes):
+//   • timestamp (TSC ticks on x86, nanoseconds elsewhere), read once every
+//     ALINKED_RECORDER_TICK_EVERY events and shared by the events in between
+//   • 32 bits of the queue address, to tell queues apart
+//   • queue length after the operation (24 bits, saturating)
+//   • operation (4 bits) and allocation source (arena, free-list or relink)
+//   • lease events are recorded against the leased queue, with its length
+//
+// Notes:
+//   - Recording is a TLS load and one 16-byte store, plus a timestamp every
+//     ALINKED_RECORDER_TICK_EVERY events: a few nanoseconds per event, where
+//     a clock read on every event cost more than the queue operation.
+//   - Each thread takes a ring on first use; a thread that exits hands its
+//     ring to the next newcomer, but it stays dumpable until then.
+//   - The dump only uses write(2) and clock_gettime(2), both async-signal-safe.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include "alinked_wait.h"
+
+#ifndef ALINKED_RECORDER_EVENTS
+#   define ALINKED_RECORDER_EVENTS 2048 // per thread, power of two
+#endif
+
+#ifndef ALINKED_RECORDER_THREADS
+#   define ALINKED_RECORDER_THREADS 64
+#endif
+
+#ifndef ALINKED_RECORDER_TICK_EVERY
+#   define ALINKED_RECORDER_TICK_EVERY 16 // events per timestamp, power of two
+#endif
+
+typedef enum
+{
+    ALINKED_OP_APPEND = 1,
+    ALINKED_OP_PREPEND,
+    ALINKED_OP_SHIFT,
+    ALINKED_OP_CANCEL,
+    ALINKED_OP_SPLIT,
+    ALINKED_OP_TRANSFER,
+    ALINKED_OP_SORT,
+    ALINKED_OP_MERGE,
+    ALINKED_OP_LEASE,
+    ALINKED_OP_ACK,
+    ALINKED_OP_NACK,
+    ALINKED_OP_EXPIRE
+} alinked_op_t;
+
+typedef enum
+{
+    ALINKED_SOURCE_NONE = 0,
+    ALINKED_SOURCE_ARENA,
+    ALINKED_SOURCE_FREE_LIST,
+    ALINKED_SOURCE_RELINK
+} alinked_source_t;
+
+typedef struct
+{
+    uint64_t ticks;
+    uint32_t queue;
+    uint32_t len : 24;
+    uint32_t op : 4;
+    uint32_t source : 4;
+} alinked_event_t;
+
+#define ALINKED_RECORDER_FREE 0u
+#define ALINKED_RECORDER_ACTIVE 1u
+#define ALINKED_RECORDER_RETIRED 2u
+
+typedef struct
+{
+    atomic_uint state;
+    uint64_t head;
+    uint64_t ticks;
+    unsigned long thread;
+    alinked_event_t events[ALINKED_RECORDER_EVENTS];
+} alinked_recorder_ring_t;
+
+typedef struct
+{
+    alinked_recorder_ring_t rings[ALINKED_RECORDER_THREADS];
+    pthread_once_t once;
+    pthread_key_t key;
+    uint64_t base_ticks;
+    uint64_t base_ns;
+} alinked_recorder_t;
+
+__attribute__((weak)) alinked_recorder_t alinked_recorder = { .once = PTHREAD_ONCE_INIT };
+__attribute__((weak)) _Thread_local alinked_recorder_ring_t *alinked_recorder_local;
+
+static inline uint64_t alinked_recorder_ticks(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return alinked_now_ns();
+#endif
+}
+
+static inline void __fluent_libc_recorder_retire(void *ring)
+{
+    atomic_store_explicit(&((alinked_recorder_ring_t *)ring)->state, ALINKED_RECORDER_RETIRED, memory_order_release);
+}
+
+static inline void __fluent_libc_recorder_setup(void)
+{
+    pthread_key_create(&alinked_recorder.key, __fluent_libc_recorder_retire);
+    alinked_recorder.base_ns = alinked_now_ns();
+    alinked_recorder.base_ticks = alinked_recorder_ticks();
+}
+
+static inline alinked_recorder_ring_t *__fluent_libc_recorder_claim(void)
+{
+    pthread_once(&alinked_recorder.once, __fluent_libc_recorder_setup);
+
+    // free rings first, so retired histories survive as long as possible
+    for (unsigned pass = ALINKED_RECORDER_FREE; pass <= ALINKED_RECORDER_RETIRED; pass += 2)
+    {
+        for (size_t i = 0; i < ALINKED_RECORDER_THREADS; i++)
+        {
+            alinked_recorder_ring_t *ring = &alinked_recorder.rings[i];
+            unsigned expected = pass;
+
+            if (atomic_compare_exchange_strong(&ring->state, &expected, ALINKED_RECORDER_ACTIVE))
+            {
+                __atomic_store_n(&ring->head, 0, __ATOMIC_RELAXED);
+                ring->thread = (unsigned long)pthread_self();
+                pthread_setspecific(alinked_recorder.key, ring);
+                return ring;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static inline void alinked_recorder_record(
+    const void *queue,
+    const alinked_op_t op,
+    const size_t len,
+    const alinked_source_t source
+)
+{
+    alinked_recorder_ring_t *ring = alinked_recorder_local;
+    if (!ring)
+    {
+        ring = __fluent_libc_recorder_claim();
+        alinked_recorder_local = ring;
+        if (!ring)
+        {
+            return;
+        }
+    }
+
+    const uint64_t head = ring->head;
+    if ((head & (ALINKED_RECORDER_TICK_EVERY - 1)) == 0)
+    {
+        ring->ticks = alinked_recorder_ticks();
+    }
+
+    alinked_event_t *event = &ring->events[head & (ALINKED_RECORDER_EVENTS - 1)];
+    event->ticks = ring->ticks;
+    event->queue = (uint32_t)(uintptr_t)queue;
+    event->len = len > 0xFFFFFF ? 0xFFFFFF : (uint32_t)len;
+    event->op = op;
+    event->source = source;
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+}
+
+static inline size_t __fluent_libc_recorder_format(char *out, uint64_t value, const unsigned base, const size_t width)
+{
+    char digits[24];
+    size_t count = 0;
+
+    do
+    {
+        digits[count++] = "0123456789abcdef"[value % base];
+        value /= base;
+    } while (value > 0);
+
+    size_t at = 0;
+    while (at + count < width)
+    {
+        out[at++] = base == 16 ? '0' : ' ';
+    }
+
+    while (count > 0)
+    {
+        out[at++] = digits[--count];
+    }
+
+    return at;
+}
+
+static inline void __fluent_libc_recorder_write(const int fd, const char *text, const size_t len)
+{
+    size_t done = 0;
+    while (done < len)
+    {
+        const ssize_t wrote = write(fd, text + done, len - done);
+        if (wrote <= 0)
+        {
+            return;
+        }
+
+        done += (size_t)wrote;
+    }
+}
+
+static inline size_t alinked_recorder_dump(const int fd)
+{
+    static const char *const ops[] = {
+        "?", "append", "prepend", "shift", "cancel", "split", "transfer",
+        "sort", "merge", "lease", "ack", "nack", "expire"
+    };
+    static const char *const sources[] = { "-", "arena", "free-list", "relink" };
+
+    const uint64_t now_ns = alinked_now_ns();
+    const uint64_t now_ticks = alinked_recorder_ticks();
+    const double ns_per_tick = now_ticks > alinked_recorder.base_ticks
+        ? (double)(now_ns - alinked_recorder.base_ns) / (double)(now_ticks - alinked_recorder.base_ticks)
+        : 1.0;
+
+    char line[160];
+    size_t total = 0;
+
+    for (size_t i = 0; i < ALINKED_RECORDER_THREADS; i++)
+    {
+        alinked_recorder_ring_t *ring = &alinked_recorder.rings[i];
+        if (atomic_load_explicit(&ring->state, memory_order_acquire) == ALINKED_RECORDER_FREE)
+        {
+            continue;
+        }
+
+        const uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        const uint64_t first = head > ALINKED_RECORDER_EVENTS ? head - ALINKED_RECORDER_EVENTS : 0;
+
+        size_t at = 0;
+        memcpy(line + at, "== thread ", 10);
+        at += 10;
+        at += __fluent_libc_recorder_format(line + at, ring->thread, 16, 0);
+        memcpy(line + at, ", events ", 9);
+        at += 9;
+        at += __fluent_libc_recorder_format(line + at, head - first, 10, 0);
+        line[at++] = '\n';
+        __fluent_libc_recorder_write(fd, line, at);
+
+        for (uint64_t seq = first; seq < head; seq++)
+        {
+            const alinked_event_t event = ring->events[seq & (ALINKED_RECORDER_EVENTS - 1)];
+            const uint64_t age = now_ticks > event.ticks ? (uint64_t)((double)(now_ticks - event.ticks) * ns_per_tick) : 0;
+
+            at = 0;
+            line[at++] = '-';
+            at += __fluent_libc_recorder_format(line + at, age, 10, 14);
+            memcpy(line + at, "ns q=", 5);
+            at += 5;
+            at += __fluent_libc_recorder_format(line + at, event.queue, 16, 8);
+            line[at++] = ' ';
+
+            const char *op = ops[event.op < sizeof(ops) / sizeof(ops[0]) ? event.op : 0];
+            const size_t op_len = strlen(op);
+            memcpy(line + at, op, op_len);
+            at += op_len;
+
+            memcpy(line + at, " len=", 5);
+            at += 5;
+            at += __fluent_libc_recorder_format(line + at, event.len, 10, 0);
+
+            const char *source = sources[event.source < sizeof(sources) / sizeof(sources[0]) ? event.source : 0];
+            const size_t source_len = strlen(source);
+            memcpy(line + at, " src=", 5);
+            at += 5;
+            memcpy(line + at, source, source_len);
+            at += source_len;
+            line[at++] = '\n';
+
+            __fluent_libc_recorder_write(fd, line, at);
+            total++;
+        }
+    }
+
+    return total;
+}
+
+static inline void __fluent_libc_recorder_on_crash(const int signo)
+{
+    static const char banner[] = "== alinked flight recorder (ages relative to the crash)\n";
+    __fluent_libc_recorder_write(STDERR_FILENO, banner, sizeof(banner) - 1);
+    alinked_recorder_dump(STDERR_FILENO);
+
+    // SA_RESETHAND restored the default action
+    raise(signo);
+}
+
+static inline void alinked_recorder_install_crash_handler(void)
+{
+    static const int signals[] = { SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT };
+    struct sigaction action;
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = __fluent_libc_recorder_on_crash;
+    action.sa_flags = SA_RESETHAND | SA_NODEFER;
+    sigemptyset(&action.sa_mask);
+
+    for (size_t i = 0; i < sizeof(signals) / sizeof(signals[0]); i++)
+    {
+        sigaction(signals[i], &action, NULL);
+    }
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_RECORDER_LIBRARY_H
@@ -0,0 +1,424 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_REGISTRY_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_REGISTRY_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Queue Registry
+// ----------------------------------------
+// Opt-in, process-wide table of named queues for operators. The thread that
+// owns a queue publishes its counters into a registry slot under a seqlock
+// whenever it likes (after a batch, once per loop...); any other thread can
+// snapshot every slot without taking a lock or slowing the owner down.
+//
+// Macro-powered & Type-safe:
+//   DEFINE_ALINKED_REGISTRY(T, name) – adds register/publish for the queue of
+//   DEFINE_ALINKED_NODE(T, name), which must come first.
+//
+// API Usage:
+// ----------------------------------------
+//   DEFINE_ALINKED_REGISTRY(int, int);
+//   alinked_registry_entry_t *e = alinked_queue_int_register(&q, "ingress");
+//   ...
+//   alinked_queue_int_publish(e, &q);     // owner thread, as often as wanted
+//
+//   alinked_registry_dump(stderr);        // any thread
+//   alinked_registry_dumper_start("/tmp/queues.txt", 5000000000ull, SIGUSR2);
+//   alinked_registry_dumper_stop();
+//   alinked_registry_unregister(e);
+//
+// Published per queue:
+//   len, high watermark, tombstones, items enqueued, enqueue rate (items/s
+//   over the last ALINKED_REGISTRY_RATE_WINDOW_NS), free-list size, bytes
+//   of the nodes this queue took fresh from the arena (`fresh_bytes`) and
+//   the time of the publish.
+//
+// Notes:
+//   - The table is a weak global, so every translation unit shares it.
+//   - The signal handler only raises a flag; the dumper thread writes.
+//   - Queues inside the concurrent wrappers (`.queue`, `.pool`) are published
+//     the same way by whoever holds them.
+//   - `fresh_bytes` is the memory report's `fresh * node_bytes` for one
+//     queue, not its `arena_bytes` (whole chunks reserved by the pool);
+//     use alinked_queue_<name>_memory for the latter.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "alinked_queue.h"
+#include "alinked_wait.h"
+
+#ifndef ALINKED_REGISTRY_CAPACITY
+#   define ALINKED_REGISTRY_CAPACITY 1024
+#endif
+
+#ifndef ALINKED_REGISTRY_NAME_LEN
+#   define ALINKED_REGISTRY_NAME_LEN 48
+#endif
+
+#ifndef ALINKED_REGISTRY_RATE_WINDOW_NS
+#   define ALINKED_REGISTRY_RATE_WINDOW_NS 1000000000ull
+#endif
+
+#define ALINKED_REGISTRY_FREE 0u
+#define ALINKED_REGISTRY_CLAIMED 1u
+#define ALINKED_REGISTRY_LIVE 2u
+
+typedef struct
+{
+    size_t len;
+    size_t high;
+    size_t dead;
+    size_t enqueued;
+    uint64_t enqueue_rate;
+    size_t free_nodes;
+    size_t fresh_bytes;
+    uint64_t published_ns;
+} alinked_queue_stats_t;
+
+typedef struct
+{
+    atomic_uint state;
+    atomic_uint seq;
+    char name[ALINKED_REGISTRY_NAME_LEN];
+    alinked_queue_stats_t stats;
+    size_t window_enqueued;
+    uint64_t window_ns;
+} alinked_registry_entry_t;
+
+typedef struct
+{
+    char name[ALINKED_REGISTRY_NAME_LEN];
+    alinked_queue_stats_t stats;
+} alinked_registry_sample_t;
+
+typedef struct
+{
+    alinked_registry_entry_t entries[ALINKED_REGISTRY_CAPACITY];
+} alinked_registry_t;
+
+typedef struct
+{
+    pthread_t thread;
+    atomic_bool running;
+    atomic_bool requested;
+    const char *path;
+    uint64_t interval_ns;
+} alinked_registry_dumper_t;
+
+__attribute__((weak)) alinked_registry_t alinked_registry;
+__attribute__((weak)) alinked_registry_dumper_t alinked_registry_dumper;
+
+static inline alinked_registry_entry_t *alinked_registry_claim(const char *name)
+{
+    for (size_t i = 0; i < ALINKED_REGISTRY_CAPACITY; i++)
+    {
+        alinked_registry_entry_t *entry = &alinked_registry.entries[i];
+        unsigned expected = ALINKED_REGISTRY_FREE;
+
+        if (atomic_load_explicit(&entry->state, memory_order_relaxed) != ALINKED_REGISTRY_FREE ||
+            !atomic_compare_exchange_strong(&entry->state, &expected, ALINKED_REGISTRY_CLAIMED))
+        {
+            continue;
+        }
+
+        const unsigned seq = atomic_load_explicit(&entry->seq, memory_order_relaxed);
+        atomic_store_explicit(&entry->seq, seq + 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_release);
+
+        size_t at = 0;
+        for (; name && name[at] && at + 1 < ALINKED_REGISTRY_NAME_LEN; at++)
+        {
+            __atomic_store_n(&entry->name[at], name[at], __ATOMIC_RELAXED);
+        }
+
+        for (; at < ALINKED_REGISTRY_NAME_LEN; at++)
+        {
+            __atomic_store_n(&entry->name[at], '\0', __ATOMIC_RELAXED);
+        }
+
+        entry->window_enqueued = 0;
+        entry->window_ns = 0;
+        atomic_store_explicit(&entry->seq, seq + 2, memory_order_release);
+        atomic_store_explicit(&entry->state, ALINKED_REGISTRY_LIVE, memory_order_release);
+        return entry;
+    }
+
+    return NULL;
+}
+
+static inline void alinked_registry_unregister(alinked_registry_entry_t *entry)
+{
+    if (entry)
+    {
+        atomic_store_explicit(&entry->state, ALINKED_REGISTRY_FREE, memory_order_release);
+    }
+}
+
+static inline void alinked_registry_write(
+    alinked_registry_entry_t *entry,
+    alinked_queue_stats_t *stats
+)
+{
+    const uint64_t now = alinked_now_ns();
+    stats->published_ns = now;
+    stats->enqueue_rate = __atomic_load_n(&entry->stats.enqueue_rate, __ATOMIC_RELAXED);
+
+    if (entry->window_ns == 0)
+    {
+        entry->window_ns = now;
+        entry->window_enqueued = stats->enqueued;
+    }
+    else if (now - entry->window_ns >= ALINKED_REGISTRY_RATE_WINDOW_NS)
+    {
+        stats->enqueue_rate = (uint64_t)((double)(stats->enqueued - entry->window_enqueued) * 1e9 /
+            (double)(now - entry->window_ns));
+        entry->window_ns = now;
+        entry->window_enqueued = stats->enqueued;
+    }
+
+    const unsigned seq = atomic_load_explicit(&entry->seq, memory_order_relaxed);
+    atomic_store_explicit(&entry->seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    __atomic_store_n(&entry->stats.len, stats->len, __ATOMIC_RELAXED);
+    __atomic_store_n(&entry->stats.high, stats->high, __ATOMIC_RELAXED);
+    __atomic_store_n(&entry->stats.dead, stats->dead, __ATOMIC_RELAXED);
+    __atomic_store_n(&entry->stats.enqueued, stats->enqueued, __ATOMIC_RELAXED);
+    __atomic_store_n(&entry->stats.enqueue_rate, stats->enqueue_rate, __ATOMIC_RELAXED);
+    __atomic_store_n(&entry->stats.free_nodes, stats->free_nodes, __ATOMIC_RELAXED);
+    __atomic_store_n(&entry->stats.fresh_bytes, stats->fresh_bytes, __ATOMIC_RELAXED);
+    __atomic_store_n(&entry->stats.published_ns, stats->published_ns, __ATOMIC_RELAXED);
+
+    atomic_store_explicit(&entry->seq, seq + 2, memory_order_release);
+}
+
+static inline bool alinked_registry_read(
+    alinked_registry_entry_t *entry,
+    alinked_registry_sample_t *sample
+)
+{
+    for (;;)
+    {
+        if (atomic_load_explicit(&entry->state, memory_order_acquire) != ALINKED_REGISTRY_LIVE)
+        {
+            return false;
+        }
+
+        const unsigned before = atomic_load_explicit(&entry->seq, memory_order_acquire);
+        if (before & 1)
+        {
+            alinked_cpu_relax();
+            continue;
+        }
+
+        for (size_t i = 0; i < ALINKED_REGISTRY_NAME_LEN; i++)
+        {
+            sample->name[i] = __atomic_load_n(&entry->name[i], __ATOMIC_RELAXED);
+        }
+
+        sample->stats.len = __atomic_load_n(&entry->stats.len, __ATOMIC_RELAXED);
+        sample->stats.high = __atomic_load_n(&entry->stats.high, __ATOMIC_RELAXED);
+        sample->stats.dead = __atomic_load_n(&entry->stats.dead, __ATOMIC_RELAXED);
+        sample->stats.enqueued = __atomic_load_n(&entry->stats.enqueued, __ATOMIC_RELAXED);
+        sample->stats.enqueue_rate = __atomic_load_n(&entry->stats.enqueue_rate, __ATOMIC_RELAXED);
+        sample->stats.free_nodes = __atomic_load_n(&entry->stats.free_nodes, __ATOMIC_RELAXED);
+        sample->stats.fresh_bytes = __atomic_load_n(&entry->stats.fresh_bytes, __ATOMIC_RELAXED);
+        sample->stats.published_ns = __atomic_load_n(&entry->stats.published_ns, __ATOMIC_RELAXED);
+
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&entry->seq, memory_order_relaxed) == before)
+        {
+            sample->name[ALINKED_REGISTRY_NAME_LEN - 1] = '\0';
+            return true;
+        }
+    }
+}
+
+static inline size_t alinked_registry_snapshot(
+    alinked_registry_sample_t *out,
+    const size_t max
+)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < ALINKED_REGISTRY_CAPACITY && count < max; i++)
+    {
+        if (alinked_registry_read(&alinked_registry.entries[i], &out[count]))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+static inline size_t alinked_registry_dump(FILE *out)
+{
+    const uint64_t now = alinked_now_ns();
+    alinked_registry_sample_t sample;
+    size_t count = 0;
+
+    fprintf(out, "%-24s %10s %10s %8s %12s %10s %8s %12s %10s\n",
+        "queue", "len", "high", "dead", "enqueued", "rate/s", "free", "fresh_B", "age_ms");
+
+    for (size_t i = 0; i < ALINKED_REGISTRY_CAPACITY; i++)
+    {
+        if (!alinked_registry_read(&alinked_registry.entries[i], &sample))
+        {
+            continue;
+        }
+
+        const alinked_queue_stats_t *s = &sample.stats;
+        fprintf(out, "%-24.24s %10zu %10zu %8zu %12zu %10llu %8zu %12zu %10llu\n",
+            sample.name, s->len, s->high, s->dead, s->enqueued, (unsigned long long)s->enqueue_rate,
+            s->free_nodes, s->fresh_bytes,
+            (unsigned long long)(now > s->published_ns ? (now - s->published_ns) / 1000000 : 0));
+        count++;
+    }
+
+    fflush(out);
+    return count;
+}
+
+static inline bool alinked_registry_dump_path(const char *path)
+{
+    FILE *out = fopen(path, "w");
+    if (!out)
+    {
+        return false;
+    }
+
+    alinked_registry_dump(out);
+    fclose(out);
+    return true;
+}
+
+static inline void __fluent_libc_registry_on_signal(const int signo)
+{
+    (void)signo;
+    atomic_store_explicit(&alinked_registry_dumper.requested, true, memory_order_relaxed);
+}
+
+static inline void *__fluent_libc_registry_dumper_main(void *arg)
+{
+    (void)arg;
+    uint64_t last = alinked_now_ns();
+
+    while (atomic_load(&alinked_registry_dumper.running))
+    {
+        const struct timespec nap = { 0, 10000000 };
+        nanosleep(&nap, NULL);
+
+        const uint64_t now = alinked_now_ns();
+        const bool due = alinked_registry_dumper.interval_ns > 0 && now - last >= alinked_registry_dumper.interval_ns;
+        if (due || atomic_exchange(&alinked_registry_dumper.requested, false))
+        {
+            alinked_registry_dump_path(alinked_registry_dumper.path);
+            last = now;
+        }
+    }
+
+    return NULL;
+}
+
+static inline bool alinked_registry_dumper_start(
+    const char *path,
+    const uint64_t interval_ns,
+    const int signo
+)
+{
+    if (atomic_exchange(&alinked_registry_dumper.running, true))
+    {
+        return false;
+    }
+
+    alinked_registry_dumper.path = path;
+    alinked_registry_dumper.interval_ns = interval_ns;
+    atomic_store(&alinked_registry_dumper.requested, false);
+
+    if (signo > 0)
+    {
+        struct sigaction action;
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = __fluent_libc_registry_on_signal;
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = SA_RESTART;
+        sigaction(signo, &action, NULL);
+    }
+
+    if (pthread_create(&alinked_registry_dumper.thread, NULL, __fluent_libc_registry_dumper_main, NULL) != 0)
+    {
+        atomic_store(&alinked_registry_dumper.running, false);
+        return false;
+    }
+
+    return true;
+}
+
+static inline void alinked_registry_dumper_stop(void)
+{
+    if (atomic_exchange(&alinked_registry_dumper.running, false))
+    {
+        pthread_join(alinked_registry_dumper.thread, NULL);
+    }
+}
+
+#define DEFINE_ALINKED_REGISTRY(V, NAME)                    \
+    static inline void alinked_queue_##NAME##_publish(      \
+        alinked_registry_entry_t *entry,                    \
+        const alinked_queue_##NAME##_t *queue               \
+    )                                                       \
+    {                                                       \
+        alinked_queue_stats_t stats;                        \
+        if (!entry)                                         \
+        {                                                   \
+            return;                                         \
+        }                                                   \
+                                                            \
+        stats.len = queue->len;                             \
+        stats.high = queue->high;                           \
+        stats.dead = queue->dead;                           \
+        stats.enqueued = queue->enqueued;                   \
+        stats.free_nodes = queue->free_list ? queue->free_list->length : 0; \
+        stats.fresh_bytes = queue->fresh * sizeof(alinked_node_##NAME##_t); \
+        alinked_registry_write(entry, &stats);              \
+    }                                                       \
+                                                            \
+    static inline alinked_registry_entry_t *alinked_queue_##NAME##_register( \
+        const alinked_queue_##NAME##_t *queue,              \
+        const char *name                                    \
+    )                                                       \
+    {                                                       \
+        alinked_registry_entry_t *entry = alinked_registry_claim(name); \
+        alinked_queue_##NAME##_publish(entry, queue);       \
+        return entry;                                       \
+    }
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_REGISTRY_LIBRARY_H
@@ -0,0 +1,383 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_RING_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_RING_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Bounded MPMC Ring
+// ----------------------------------------
+// Bounded multi-producer multi-consumer ring (Vyukov style): a power-of-two
+// array of slots, each carrying a sequence number that says whose turn it
+// is. Producers and consumers claim positions with one CAS on their own
+// cursor and never touch the other side's line. Companion to the linked
+// queues for channels whose depth should be capped rather than grown.
+//
+// Macro-powered & Type-safe:
+//   DEFINE_ALINKED_RING(T, name) – creates a ring type and API for type `T`;
+//   it needs no DEFINE_ALINKED_NODE.
+//
+// API Usage:
+// ----------------------------------------
+//   DEFINE_ALINKED_RING(void *, generic);
+//   alinked_ring_generic_t q;
+//   alinked_ring_generic_init(&q, 1000);       // rounded up to 1024 slots
+//   if (!alinked_ring_generic_push(&q, msg)) full(msg); // any thread
+//   void *out;
+//   if (alinked_ring_generic_try_pop(&q, &out)) use(out); // any thread
+//   size_t sent = alinked_ring_generic_push_batch(&q, items, n); // may be < n
+//   size_t got = alinked_ring_generic_pop_batch(&q, buf, 64);
+//   alinked_ring_generic_destroy(&q);
+//
+//   // init/push/try_pop/push_batch/pop_batch/len* match the linked SPSC and
+//   // MPSC queues, so code that names the channel through a prefix switches
+//   // between bounded and unbounded in one line:
+//   #define CHAN(x) alinked_ring_generic_##x // or alinked_mpsc_generic_##x
+//   CHAN(t) chan;
+//   CHAN(init)(&chan, 1024);                 // slots, or arena chunk length
+//   CHAN(push)(&chan, msg);
+//
+// Internals:
+//   - Slot `i` is free for position `p` when `seq == p`, and holds the item
+//     of `p` when `seq == p + 1`; popping sets it to `p + capacity`.
+//   - Batches claim a run of positions with one CAS, sized from the other
+//     cursor so every slot in the run is already promised, then wait per
+//     slot (spin, then yield) for a lagging peer to finish with it.
+//   - A claimant preempted between its CAS and its sequence store holds up
+//     that one slot, as in the single-item operations.
+//
+// Notes:
+//   - push/try_pop never wait: a slot a peer has claimed but not finished
+//     reads as full/empty. push_batch/pop_batch do wait, slot by slot, so a
+//     peer preempted mid-claim stalls the batch caller until it runs again;
+//     use the single-item calls where a thread must never block.
+//   - A capacity whose slot array cannot be sized (above SIZE_MAX / 2 + 1
+//     slots, or too many bytes) leaves `slots` NULL, as a failed malloc does.
+//   - The switch is one line for the calls above only: the ring is bounded
+//     (push can fail when full), the linked queues only fail on allocation,
+//     and snapshot/producer handles exist on the MPSC alone.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "alinked_wait.h"
+
+#define DEFINE_ALINKED_RING(V, NAME)                        \
+    typedef struct                                          \
+    {                                                       \
+        atomic_size_t seq;                                  \
+        V data;                                             \
+    } alinked_ring_slot_##NAME##_t;                         \
+                                                            \
+    typedef struct                                          \
+    {                                                       \
+        _Alignas(ALINKED_CACHE_LINE) atomic_size_t tail;    \
+        _Alignas(ALINKED_CACHE_LINE) atomic_size_t head;    \
+        _Alignas(ALINKED_CACHE_LINE) alinked_ring_slot_##NAME##_t *slots; \
+        size_t mask;                                        \
+    } alinked_ring_##NAME##_t;                              \
+                                                            \
+    static inline void alinked_ring_##NAME##_init(          \
+        alinked_ring_##NAME##_t *ring,                      \
+        const size_t capacity                               \
+    )                                                       \
+    {                                                       \
+        atomic_init(&ring->tail, 0);                        \
+        atomic_init(&ring->head, 0);                        \
+        ring->slots = NULL;                                 \
+        ring->mask = 0;                                     \
+                                                            \
+        if (capacity > SIZE_MAX / 2 + 1)                    \
+        {                                                   \
+            return;                                         \
+        }                                                   \
+                                                            \
+        size_t slots = 2;                                   \
+        while (slots < capacity)                            \
+        {                                                   \
+            slots <<= 1;                                    \
+        }                                                   \
+                                                            \
+        if (slots > SIZE_MAX / sizeof(alinked_ring_slot_##NAME##_t)) \
+        {                                                   \
+            return;                                         \
+        }                                                   \
+                                                            \
+        ring->slots = malloc(slots * sizeof(alinked_ring_slot_##NAME##_t)); \
+        if (!ring->slots)                                   \
+        {                                                   \
+            ring->mask = 0;                                 \
+            return;                                         \
+        }                                                   \
+                                                            \
+        ring->mask = slots - 1;                             \
+        for (size_t i = 0; i < slots; i++)                  \
+        {                                                   \
+            atomic_init(&ring->slots[i].seq, i);            \
+        }                                                   \
+    }                                                       \
+                                                            \
+    static inline void alinked_ring_##NAME##_destroy(       \
+        alinked_ring_##NAME##_t *ring                       \
+    )                                                       \
+    {                                                       \
+        free(ring->slots);                                  \
+        ring->slots = NULL;                                 \
+        ring->mask = 0;                                     \
+        atomic_store(&ring->tail, 0);                       \
+        atomic_store(&ring->head, 0);                       \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_ring_##NAME##_capacity(    \
+        const alinked_ring_##NAME##_t *ring                 \
+    )                                                       \
+    {                                                       \
+        return ring->slots ? ring->mask + 1 : 0;            \
+    }                                                       \
+                                                            \
+    static inline bool alinked_ring_##NAME##_push(          \
+        alinked_ring_##NAME##_t *ring,                      \
+        V data                                              \
+    )                                                       \
+    {                                                       \
+        if (!ring->slots)                                   \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        size_t pos = atomic_load_explicit(&ring->tail, memory_order_relaxed); \
+        for (;;)                                            \
+        {                                                   \
+            alinked_ring_slot_##NAME##_t *slot = &ring->slots[pos & ring->mask]; \
+            const size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire); \
+            const ptrdiff_t diff = (ptrdiff_t)(seq - pos);  \
+                                                            \
+            if (diff == 0)                                  \
+            {                                               \
+                if (atomic_compare_exchange_weak_explicit(&ring->tail, &pos, pos + 1, \
+                    memory_order_relaxed, memory_order_relaxed)) \
+                {                                           \
+                    slot->data = data;                      \
+                    atomic_store_explicit(&slot->seq, pos + 1, memory_order_release); \
+                    return true;                            \
+                }                                           \
+            }                                               \
+            else if (diff < 0)                              \
+            {                                               \
+                return false;                               \
+            }                                               \
+            else                                            \
+            {                                               \
+                pos = atomic_load_explicit(&ring->tail, memory_order_relaxed); \
+            }                                               \
+        }                                                   \
+    }                                                       \
+                                                            \
+    static inline bool alinked_ring_##NAME##_try_pop(       \
+        alinked_ring_##NAME##_t *ring,                      \
+        V *out                                              \
+    )                                                       \
+    {                                                       \
+        if (!ring->slots)                                   \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        size_t pos = atomic_load_explicit(&ring->head, memory_order_relaxed); \
+        for (;;)                                            \
+        {                                                   \
+            alinked_ring_slot_##NAME##_t *slot = &ring->slots[pos & ring->mask]; \
+            const size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire); \
+            const ptrdiff_t diff = (ptrdiff_t)(seq - (pos + 1)); \
+                                                            \
+            if (diff == 0)                                  \
+            {                                               \
+                if (atomic_compare_exchange_weak_explicit(&ring->head, &pos, pos + 1, \
+                    memory_order_relaxed, memory_order_relaxed)) \
+                {                                           \
+                    *out = slot->data;                      \
+                    atomic_store_explicit(&slot->seq, pos + ring->mask + 1, memory_order_release); \
+                    return true;                            \
+                }                                           \
+            }                                               \
+            else if (diff < 0)                              \
+            {                                               \
+                return false;                               \
+            }                                               \
+            else                                            \
+            {                                               \
+                pos = atomic_load_explicit(&ring->head, memory_order_relaxed); \
+            }                                               \
+        }                                                   \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_ring_##NAME##_push_batch(  \
+        alinked_ring_##NAME##_t *ring,                      \
+        V const *items,                                     \
+        const size_t count                                  \
+    )                                                       \
+    {                                                       \
+        if (!ring->slots || count == 0)                     \
+        {                                                   \
+            return 0;                                       \
+        }                                                   \
+                                                            \
+        const size_t capacity = ring->mask + 1;             \
+        size_t pos = atomic_load_explicit(&ring->tail, memory_order_relaxed); \
+        size_t take;                                        \
+        for (;;)                                            \
+        {                                                   \
+            const size_t head = atomic_load_explicit(&ring->head, memory_order_acquire); \
+            const size_t used = pos - head;                 \
+            if ((ptrdiff_t)used < 0 || used >= capacity)    \
+            {                                               \
+                if ((ptrdiff_t)used < 0)                    \
+                {                                           \
+                    pos = atomic_load_explicit(&ring->tail, memory_order_relaxed); \
+                    continue;                               \
+                }                                           \
+                                                            \
+                return 0;                                   \
+            }                                               \
+                                                            \
+            take = capacity - used < count ? capacity - used : count; \
+            if (atomic_compare_exchange_weak_explicit(&ring->tail, &pos, pos + take, \
+                memory_order_relaxed, memory_order_relaxed)) \
+            {                                               \
+                break;                                      \
+            }                                               \
+        }                                                   \
+                                                            \
+        size_t spins = 0;                                   \
+        for (size_t i = 0; i < take; i++)                   \
+        {                                                   \
+            alinked_ring_slot_##NAME##_t *slot = &ring->slots[(pos + i) & ring->mask]; \
+            while (atomic_load_explicit(&slot->seq, memory_order_acquire) != pos + i) \
+            {                                               \
+                alinked_wait_idle(ALINKED_WAIT_YIELD, &spins); \
+            }                                               \
+                                                            \
+            slot->data = items[i];                          \
+            atomic_store_explicit(&slot->seq, pos + i + 1, memory_order_release); \
+        }                                                   \
+                                                            \
+        return take;                                        \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_ring_##NAME##_pop_batch(   \
+        alinked_ring_##NAME##_t *ring,                      \
+        V *out,                                             \
+        const size_t max                                    \
+    )                                                       \
+    {                                                       \
+        if (!ring->slots || max == 0)                       \
+        {                                                   \
+            return 0;                                       \
+        }                                                   \
+                                                            \
+        size_t pos = atomic_load_explicit(&ring->head, memory_order_relaxed); \
+        size_t take;                                        \
+        for (;;)                                            \
+        {                                                   \
+            const size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire); \
+            const size_t ready = tail - pos;                \
+            if ((ptrdiff_t)ready <= 0)                      \
+            {                                               \
+                if ((ptrdiff_t)ready < 0)                   \
+                {                                           \
+                    pos = atomic_load_explicit(&ring->head, memory_order_relaxed); \
+                    continue;                               \
+                }                                           \
+                                                            \
+                return 0;                                   \
+            }                                               \
+                                                            \
+            take = ready < max ? ready : max;               \
+            if (atomic_compare_exchange_weak_explicit(&ring->head, &pos, pos + take, \
+                memory_order_relaxed, memory_order_relaxed)) \
+            {                                               \
+                break;                                      \
+            }                                               \
+        }                                                   \
+                                                            \
+        size_t spins = 0;                                   \
+        for (size_t i = 0; i < take; i++)                   \
+        {                                                   \
+            alinked_ring_slot_##NAME##_t *slot = &ring->slots[(pos + i) & ring->mask]; \
+            while (atomic_load_explicit(&slot->seq, memory_order_acquire) != pos + i + 1) \
+            {                                               \
+                alinked_wait_idle(ALINKED_WAIT_YIELD, &spins); \
+            }                                               \
+                                                            \
+            out[i] = slot->data;                            \
+            atomic_store_explicit(&slot->seq, pos + i + ring->mask + 1, memory_order_release); \
+        }                                                   \
+                                                            \
+        return take;                                        \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_ring_##NAME##_len_relaxed( \
+        alinked_ring_##NAME##_t *ring                       \
+    )                                                       \
+    {                                                       \
+        const size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed); \
+        const size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed); \
+        return (ptrdiff_t)(tail - head) > 0 ? tail - head : 0; \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_ring_##NAME##_len_exact(   \
+        alinked_ring_##NAME##_t *ring                       \
+    )                                                       \
+    {                                                       \
+        for (;;)                                            \
+        {                                                   \
+            const size_t tail = atomic_load(&ring->tail);   \
+            const size_t head = atomic_load(&ring->head);   \
+            if (atomic_load(&ring->tail) == tail)           \
+            {                                               \
+                return (ptrdiff_t)(tail - head) > 0 ? tail - head : 0; \
+            }                                               \
+                                                            \
+            alinked_cpu_relax();                            \
+        }                                                   \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_ring_##NAME##_len(         \
+        alinked_ring_##NAME##_t *ring                       \
+    )                                                       \
+    {                                                       \
+        return alinked_ring_##NAME##_len_relaxed(ring);     \
+    }                                                       \
+                                                            \
+    static inline bool alinked_ring_##NAME##_is_empty(      \
+        alinked_ring_##NAME##_t *ring                       \
+    )                                                       \
+    {                                                       \
+        return alinked_ring_##NAME##_len_relaxed(ring) == 0; \
+    }
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_RING_LIBRARY_H
@@ -0,0 +1,240 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_SPSC_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_SPSC_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Single-Producer Single-Consumer Linked Queue
+// ----------------------------------------
+// Unbounded SPSC queue on the arena nodes of `alinked_queue_<name>_t`.
+// The producer recycles nodes the consumer has already passed, so after
+// warm-up neither side allocates, locks or issues an atomic RMW.
+//
+// Macro-powered & Type-safe:
+//   DEFINE_ALINKED_SPSC(T, name) – creates an SPSC queue on the node type of
+//   DEFINE_ALINKED_NODE(T, name), which must come first.
+//
+// API Usage:
+// ----------------------------------------
+//   DEFINE_ALINKED_SPSC(void *, generic);
+//   alinked_spsc_generic_t q;
+//   alinked_spsc_generic_init(&q, 512);
+//   alinked_spsc_generic_push_batch(&q, items, n);       // producer thread
+//   size_t got = alinked_spsc_generic_pop_batch(&q, out, 64); // consumer thread
+//   alinked_spsc_generic_destroy(&q);
+//
+// Internals:
+//   - Nodes from `first` up to the consumer's last seen head are free again;
+//     the producer walks that range before touching the arena.
+//   - `pushed` and `popped` are each written by one side only, their
+//     difference is the depth. There is no `len_exact`: with the other side
+//     running no read of the pair is more exact than `len_relaxed`, and
+//     either side reading it is exact with respect to its own operations.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <stdatomic.h>
+#include "alinked_queue.h"
+#include "alinked_wait.h"
+
+#define DEFINE_ALINKED_SPSC(V, NAME)                        \
+    typedef struct                                          \
+    {                                                       \
+        _Alignas(ALINKED_CACHE_LINE) alinked_node_##NAME##_t *head; \
+        atomic_size_t popped;                               \
+        _Alignas(ALINKED_CACHE_LINE) alinked_node_##NAME##_t *tail; \
+        alinked_node_##NAME##_t *first;                     \
+        alinked_node_##NAME##_t *head_copy;                 \
+        atomic_size_t pushed;                               \
+        alinked_queue_##NAME##_t pool;                      \
+    } alinked_spsc_##NAME##_t;                              \
+                                                            \
+    static inline void alinked_spsc_##NAME##_init(          \
+        alinked_spsc_##NAME##_t *spsc,                      \
+        const size_t arena_len                              \
+    )                                                       \
+    {                                                       \
+        alinked_queue_##NAME##_init(&spsc->pool, arena_len); \
+        atomic_init(&spsc->pushed, 0);                      \
+        atomic_init(&spsc->popped, 0);                      \
+        spsc->head = NULL;                                  \
+        spsc->tail = NULL;                                  \
+        spsc->first = NULL;                                 \
+        spsc->head_copy = NULL;                             \
+                                                            \
+        if (!spsc->pool.allocator)                          \
+        {                                                   \
+            return;                                         \
+        }                                                   \
+                                                            \
+        alinked_node_##NAME##_t *stub = __fluent_libc_##NAME##_linked_queue_suitable(&spsc->pool); \
+        if (stub)                                           \
+        {                                                   \
+            stub->next = NULL;                              \
+            spsc->head = stub;                              \
+            spsc->tail = stub;                              \
+            spsc->first = stub;                             \
+            spsc->head_copy = stub;                         \
+        }                                                   \
+    }                                                       \
+                                                            \
+    static inline void alinked_spsc_##NAME##_destroy(       \
+        alinked_spsc_##NAME##_t *spsc                       \
+    )                                                       \
+    {                                                       \
+        alinked_queue_##NAME##_destroy(&spsc->pool);        \
+        spsc->head = NULL;                                  \
+        spsc->tail = NULL;                                  \
+        spsc->first = NULL;                                 \
+        spsc->head_copy = NULL;                             \
+    }                                                       \
+                                                            \
+    static inline alinked_node_##NAME##_t *__fluent_libc_##NAME##_spsc_node( \
+        alinked_spsc_##NAME##_t *spsc                       \
+    )                                                       \
+    {                                                       \
+        if (spsc->first == spsc->head_copy)                 \
+        {                                                   \
+            spsc->head_copy = __atomic_load_n(&spsc->head, __ATOMIC_ACQUIRE); \
+        }                                                   \
+                                                            \
+        if (spsc->first != spsc->head_copy)                 \
+        {                                                   \
+            alinked_node_##NAME##_t *node = spsc->first;    \
+            spsc->first = node->next;                       \
+            return node;                                    \
+        }                                                   \
+                                                            \
+        return __fluent_libc_##NAME##_linked_queue_suitable(&spsc->pool); \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_spsc_##NAME##_push_batch(  \
+        alinked_spsc_##NAME##_t *spsc,                      \
+        V const *items,                                     \
+        const size_t count                                  \
+    )                                                       \
+    {                                                       \
+        alinked_node_##NAME##_t *chain = NULL;              \
+        alinked_node_##NAME##_t *last = NULL;               \
+        size_t linked = 0;                                  \
+                                                            \
+        while (linked < count)                              \
+        {                                                   \
+            alinked_node_##NAME##_t *node = __fluent_libc_##NAME##_spsc_node(spsc); \
+            if (!node)                                      \
+            {                                               \
+                break;                                      \
+            }                                               \
+                                                            \
+            node->data = items[linked++];                   \
+            node->next = NULL;                              \
+            if (last)                                       \
+            {                                               \
+                last->next = node;                          \
+            }                                               \
+            else                                            \
+            {                                               \
+                chain = node;                               \
+            }                                               \
+                                                            \
+            last = node;                                    \
+        }                                                   \
+                                                            \
+        if (chain)                                          \
+        {                                                   \
+            __atomic_store_n(&spsc->tail->next, chain, __ATOMIC_RELEASE); \
+            spsc->tail = last;                              \
+            atomic_store_explicit(&spsc->pushed,            \
+                atomic_load_explicit(&spsc->pushed, memory_order_relaxed) + linked, \
+                memory_order_relaxed);                      \
+        }                                                   \
+                                                            \
+        return linked;                                      \
+    }                                                       \
+                                                            \
+    static inline bool alinked_spsc_##NAME##_push(          \
+        alinked_spsc_##NAME##_t *spsc,                      \
+        V data                                              \
+    )                                                       \
+    {                                                       \
+        return alinked_spsc_##NAME##_push_batch(spsc, &data, 1) == 1; \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_spsc_##NAME##_pop_batch(   \
+        alinked_spsc_##NAME##_t *spsc,                      \
+        V *out,                                             \
+        const size_t max                                    \
+    )                                                       \
+    {                                                       \
+        alinked_node_##NAME##_t *head = spsc->head;         \
+        size_t count = 0;                                   \
+                                                            \
+        while (count < max)                                 \
+        {                                                   \
+            alinked_node_##NAME##_t *next = __atomic_load_n(&head->next, __ATOMIC_ACQUIRE); \
+            if (!next)                                      \
+            {                                               \
+                break;                                      \
+            }                                               \
+                                                            \
+            out[count++] = next->data;                      \
+            head = next;                                    \
+        }                                                   \
+                                                            \
+        if (count > 0)                                      \
+        {                                                   \
+            __atomic_store_n(&spsc->head, head, __ATOMIC_RELEASE); \
+            atomic_store_explicit(&spsc->popped,            \
+                atomic_load_explicit(&spsc->popped, memory_order_relaxed) + count, \
+                memory_order_relaxed);                      \
+        }                                                   \
+                                                            \
+        return count;                                       \
+    }                                                       \
+                                                            \
+    static inline bool alinked_spsc_##NAME##_try_pop(       \
+        alinked_spsc_##NAME##_t *spsc,                      \
+        V *out                                              \
+    )                                                       \
+    {                                                       \
+        return alinked_spsc_##NAME##_pop_batch(spsc, out, 1) == 1; \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_spsc_##NAME##_len_relaxed( \
+        alinked_spsc_##NAME##_t *spsc                       \
+    )                                                       \
+    {                                                       \
+        const size_t popped = atomic_load_explicit(&spsc->popped, memory_order_relaxed); \
+        const size_t pushed = atomic_load_explicit(&spsc->pushed, memory_order_relaxed); \
+        return pushed > popped ? pushed - popped : 0;       \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_spsc_##NAME##_len(         \
+        alinked_spsc_##NAME##_t *spsc                       \
+    )                                                       \
+    {                                                       \
+        return alinked_spsc_##NAME##_len_relaxed(spsc);     \
+    }
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_SPSC_LIBRARY_H
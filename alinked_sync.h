@@ -0,0 +1,386 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_SYNC_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_SYNC_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Thread-Safe Linked Queue & Multi-Queue Select
+// ----------------------------------------
+// Mutex-protected wrapper around `alinked_queue_<name>_t` that publishes its
+// length atomically and signals an `alinked_signal_t` whenever it goes from
+// empty to non-empty. A consumer serving several queues registers them in an
+// `alinked_select_t` and sleeps on a single futex until any becomes ready.
+//
+// Macro-powered & Type-safe:
+//   DEFINE_ALINKED_SYNC(T, name) – creates a thread-safe queue on top of
+//   `alinked_queue_<name>_t`, so DEFINE_ALINKED_NODE(T, name) must come first.
+//
+// API Usage:
+// ----------------------------------------
+//   DEFINE_ALINKED_SYNC(void *, generic);
+//   alinked_sync_generic_t control, data;
+//   alinked_sync_generic_init(&control, 64);
+//   alinked_sync_generic_init(&data, 512);
+//
+//   alinked_select_t sel;
+//   alinked_select_init(&sel, ALINKED_SELECT_PRIORITY);
+//   alinked_sync_generic_select(&control, &sel); // index 0, served first
+//   alinked_sync_generic_select(&data, &sel);    // index 1
+//
+//   void *msg;
+//   alinked_select_set_wait(&sel, ALINKED_WAIT_PARK); // default, see alinked_wait.h
+//   size_t ready = alinked_select_wait(&sel);
+//   if (alinked_sync_generic_try_shift(ready == 0 ? &control : &data, &msg)) handle(msg);
+//   alinked_sync_generic_deselect(&data, &sel); // back to its own signal
+//
+// Notes:
+//   - A queue notifies one signal: its own, or the one of the select it joined.
+//     It joins at most one select: select returns ALINKED_SELECT_NONE for a
+//     queue that already belongs to one. deselect leaves the select (its
+//     index is not reused) and points the queue back at its own signal; do
+//     it while no thread waits on either, and before destroying the queue.
+//   - One waiter is woken per empty → non-empty transition, and a consumer
+//     that shifts while items remain wakes the next sleeper, so a burst
+//     drains through every parked consumer; consumers should still loop on
+//     select_wait, which never sleeps while a source is ready.
+//   - `len_relaxed` reads the published mirror without touching the lock;
+//     `len_exact` takes the lock and reads the queue itself.
+//   - append and prepend return false (append_batch a short count) when the
+//     queue cannot allocate a node; nothing past that point was queued.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <pthread.h>
+#include <stdatomic.h>
+#include "alinked_queue.h"
+#include "alinked_wait.h"
+
+#ifndef ALINKED_SELECT_MAX
+#   define ALINKED_SELECT_MAX 32
+#endif
+
+#define ALINKED_SELECT_NONE ((size_t)-1)
+
+typedef enum
+{
+    ALINKED_SELECT_FAIR = 0,
+    ALINKED_SELECT_PRIORITY
+} alinked_select_mode_t;
+
+typedef struct
+{
+    alinked_signal_t signal;
+    const atomic_size_t *sources[ALINKED_SELECT_MAX];
+    size_t count;
+    size_t next;
+    alinked_select_mode_t mode;
+    alinked_wait_strategy_t wait;
+} alinked_select_t;
+
+static inline void alinked_select_init(alinked_select_t *select, const alinked_select_mode_t mode)
+{
+    alinked_signal_init(&select->signal);
+    select->count = 0;
+    select->next = 0;
+    select->mode = mode;
+    select->wait = ALINKED_WAIT_PARK;
+}
+
+static inline void alinked_select_set_wait(alinked_select_t *select, const alinked_wait_strategy_t wait)
+{
+    select->wait = wait;
+}
+
+static inline size_t alinked_select_add(alinked_select_t *select, const atomic_size_t *len)
+{
+    if (select->count == ALINKED_SELECT_MAX)
+    {
+        return ALINKED_SELECT_NONE;
+    }
+
+    select->sources[select->count] = len;
+    return select->count++;
+}
+
+static inline void alinked_select_remove(alinked_select_t *select, const atomic_size_t *len)
+{
+    for (size_t i = 0; i < select->count; i++)
+    {
+        if (select->sources[i] == len)
+        {
+            select->sources[i] = NULL;
+        }
+    }
+}
+
+static inline size_t alinked_select_poll(alinked_select_t *select)
+{
+    const size_t start = select->mode == ALINKED_SELECT_FAIR ? select->next : 0;
+
+    for (size_t i = 0; i < select->count; i++)
+    {
+        size_t at = start + i;
+        if (at >= select->count)
+        {
+            at -= select->count;
+        }
+
+        if (select->sources[at] && atomic_load_explicit(select->sources[at], memory_order_acquire) > 0)
+        {
+            select->next = at + 1 == select->count ? 0 : at + 1;
+            return at;
+        }
+    }
+
+    return ALINKED_SELECT_NONE;
+}
+
+static inline size_t alinked_select_wait(alinked_select_t *select)
+{
+    size_t spins = 0;
+    for (;;)
+    {
+        const unsigned epoch = alinked_signal_prepare(&select->signal);
+        const size_t ready = alinked_select_poll(select);
+        if (ready != ALINKED_SELECT_NONE)
+        {
+            return ready;
+        }
+
+        alinked_wait_signal(select->wait, &select->signal, epoch, &spins);
+    }
+}
+
+#define DEFINE_ALINKED_SYNC(V, NAME)                        \
+    typedef struct                                          \
+    {                                                       \
+        pthread_mutex_t lock;                               \
+        alinked_queue_##NAME##_t queue;                     \
+        atomic_size_t len;                                  \
+        alinked_signal_t *signal;                           \
+        alinked_signal_t own_signal;                        \
+        alinked_wait_strategy_t wait;                       \
+    } alinked_sync_##NAME##_t;                              \
+                                                            \
+    static inline void alinked_sync_##NAME##_init(          \
+        alinked_sync_##NAME##_t *sync,                      \
+        const size_t arena_len                              \
+    )                                                       \
+    {                                                       \
+        pthread_mutex_init(&sync->lock, NULL);              \
+        alinked_queue_##NAME##_init(&sync->queue, arena_len); \
+        atomic_init(&sync->len, 0);                         \
+        alinked_signal_init(&sync->own_signal);             \
+        sync->signal = &sync->own_signal;                   \
+        sync->wait = ALINKED_WAIT_PARK;                     \
+    }                                                       \
+                                                            \
+    static inline void alinked_sync_##NAME##_set_wait(      \
+        alinked_sync_##NAME##_t *sync,                      \
+        const alinked_wait_strategy_t wait                  \
+    )                                                       \
+    {                                                       \
+        sync->wait = wait;                                  \
+    }                                                       \
+                                                            \
+    static inline void alinked_sync_##NAME##_destroy(       \
+        alinked_sync_##NAME##_t *sync                       \
+    )                                                       \
+    {                                                       \
+        alinked_queue_##NAME##_destroy(&sync->queue);       \
+        pthread_mutex_destroy(&sync->lock);                 \
+        atomic_store(&sync->len, 0);                        \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_sync_##NAME##_select(      \
+        alinked_sync_##NAME##_t *sync,                      \
+        alinked_select_t *select                            \
+    )                                                       \
+    {                                                       \
+        pthread_mutex_lock(&sync->lock);                    \
+        size_t index = ALINKED_SELECT_NONE;                 \
+        if (sync->signal == &sync->own_signal)              \
+        {                                                   \
+            index = alinked_select_add(select, &sync->len); \
+        }                                                   \
+                                                            \
+        if (index != ALINKED_SELECT_NONE)                   \
+        {                                                   \
+            sync->signal = &select->signal;                 \
+        }                                                   \
+                                                            \
+        pthread_mutex_unlock(&sync->lock);                  \
+        return index;                                       \
+    }                                                       \
+                                                            \
+    static inline bool alinked_sync_##NAME##_deselect(      \
+        alinked_sync_##NAME##_t *sync,                      \
+        alinked_select_t *select                            \
+    )                                                       \
+    {                                                       \
+        pthread_mutex_lock(&sync->lock);                    \
+        const bool member = sync->signal == &select->signal; \
+        if (member)                                         \
+        {                                                   \
+            alinked_select_remove(select, &sync->len);      \
+            sync->signal = &sync->own_signal;               \
+        }                                                   \
+                                                            \
+        pthread_mutex_unlock(&sync->lock);                  \
+        return member;                                      \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_sync_##NAME##_len_relaxed( \
+        alinked_sync_##NAME##_t *sync                       \
+    )                                                       \
+    {                                                       \
+        return atomic_load_explicit(&sync->len, memory_order_relaxed); \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_sync_##NAME##_len_exact(   \
+        alinked_sync_##NAME##_t *sync                       \
+    )                                                       \
+    {                                                       \
+        pthread_mutex_lock(&sync->lock);                    \
+        const size_t len = sync->queue.len;                 \
+        pthread_mutex_unlock(&sync->lock);                  \
+        return len;                                         \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_sync_##NAME##_len(         \
+        alinked_sync_##NAME##_t *sync                       \
+    )                                                       \
+    {                                                       \
+        return alinked_sync_##NAME##_len_relaxed(sync);     \
+    }                                                       \
+                                                            \
+    static inline void __fluent_libc_##NAME##_sync_publish( \
+        alinked_sync_##NAME##_t *sync,                      \
+        const size_t before                                 \
+    )                                                       \
+    {                                                       \
+        const size_t after = sync->queue.len;               \
+        alinked_signal_t *signal = sync->signal;            \
+        atomic_store_explicit(&sync->len, after, memory_order_release); \
+        pthread_mutex_unlock(&sync->lock);                  \
+                                                            \
+        if (before == 0 && after > 0)                       \
+        {                                                   \
+            alinked_signal_notify(signal);                  \
+        }                                                   \
+    }                                                       \
+                                                            \
+    static inline bool alinked_sync_##NAME##_append(        \
+        alinked_sync_##NAME##_t *sync,                      \
+        V data                                              \
+    )                                                       \
+    {                                                       \
+        pthread_mutex_lock(&sync->lock);                    \
+        const size_t before = sync->queue.len;              \
+        const bool ok = alinked_queue_##NAME##_append_handle(&sync->queue, data).node != NULL; \
+        __fluent_libc_##NAME##_sync_publish(sync, before);  \
+        return ok;                                          \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_sync_##NAME##_append_batch( \
+        alinked_sync_##NAME##_t *sync,                      \
+        V const *items,                                     \
+        const size_t count                                  \
+    )                                                       \
+    {                                                       \
+        size_t appended = 0;                                \
+        pthread_mutex_lock(&sync->lock);                    \
+        const size_t before = sync->queue.len;              \
+        while (appended < count &&                          \
+            alinked_queue_##NAME##_append_handle(&sync->queue, items[appended]).node) \
+        {                                                   \
+            appended++;                                     \
+        }                                                   \
+                                                            \
+        __fluent_libc_##NAME##_sync_publish(sync, before);  \
+        return appended;                                    \
+    }                                                       \
+                                                            \
+    static inline bool alinked_sync_##NAME##_prepend(       \
+        alinked_sync_##NAME##_t *sync,                      \
+        V data                                              \
+    )                                                       \
+    {                                                       \
+        pthread_mutex_lock(&sync->lock);                    \
+        const size_t before = sync->queue.len;              \
+        const bool ok = alinked_queue_##NAME##_prepend_handle(&sync->queue, data).node != NULL; \
+        __fluent_libc_##NAME##_sync_publish(sync, before);  \
+        return ok;                                          \
+    }                                                       \
+                                                            \
+    static inline bool alinked_sync_##NAME##_try_shift(     \
+        alinked_sync_##NAME##_t *sync,                      \
+        V *out                                              \
+    )                                                       \
+    {                                                       \
+        if (atomic_load_explicit(&sync->len, memory_order_acquire) == 0) \
+        {                                                   \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        pthread_mutex_lock(&sync->lock);                    \
+        if (sync->queue.len == 0)                           \
+        {                                                   \
+            pthread_mutex_unlock(&sync->lock);              \
+            return false;                                   \
+        }                                                   \
+                                                            \
+        *out = alinked_queue_##NAME##_shift(&sync->queue);  \
+        const size_t left = sync->queue.len;                \
+        alinked_signal_t *signal = sync->signal;            \
+        atomic_store_explicit(&sync->len, left, memory_order_relaxed); \
+        pthread_mutex_unlock(&sync->lock);                  \
+                                                            \
+        if (left > 0 && atomic_load(&signal->sleepers) > 0) \
+        {                                                   \
+            alinked_signal_notify(signal);                  \
+        }                                                   \
+                                                            \
+        return true;                                        \
+    }                                                       \
+                                                            \
+    static inline V alinked_sync_##NAME##_shift_wait(       \
+        alinked_sync_##NAME##_t *sync                       \
+    )                                                       \
+    {                                                       \
+        V out;                                              \
+        size_t spins = 0;                                   \
+        for (;;)                                            \
+        {                                                   \
+            const unsigned epoch = alinked_signal_prepare(sync->signal); \
+            if (alinked_sync_##NAME##_try_shift(sync, &out)) \
+            {                                               \
+                return out;                                 \
+            }                                               \
+                                                            \
+            alinked_wait_signal(sync->wait, sync->signal, epoch, &spins); \
+        }                                                   \
+    }
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_SYNC_LIBRARY_H
@@ -0,0 +1,312 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_TWOLOCK_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_TWOLOCK_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Two-Lock Linked Queue
+// ----------------------------------------
+// Michael & Scott two-lock queue on the arena nodes of
+// `alinked_queue_<name>_t`. A dummy node keeps head and tail apart, so
+// `append` only takes the tail lock and `shift` only the head lock:
+// producers contend with producers, consumers with consumers, and the two
+// sides never wait on each other.
+//
+// Macro-powered & Type-safe:
+//   DEFINE_ALINKED_TWOLOCK(T, name) – creates a two-lock queue on the node
+//   type of DEFINE_ALINKED_NODE(T, name), which must come first.
+//
+// API Usage:
+// ----------------------------------------
+//   DEFINE_ALINKED_TWOLOCK(void *, generic);
+//   alinked_twolock_generic_t q;
+//   alinked_twolock_generic_init(&q, 512);
+//   alinked_twolock_generic_append(&q, msg);          // any thread
+//   alinked_twolock_generic_append_batch(&q, msgs, n); // one tail lock for n
+//   void *out;
+//   if (alinked_twolock_generic_try_shift(&q, &out)) use(out); // any thread
+//   size_t got = alinked_twolock_generic_shift_batch(&q, buf, 64);
+//   alinked_twolock_generic_destroy(&q);
+//
+// Internals:
+//   - Head lock + head pointer and tail lock + tail pointer each own a cache
+//     line, so a lock and the pointer it guards arrive together.
+//   - Only producers touch the node pool (under the tail lock). Consumers
+//     keep the dummies they pass on a private chain and hand it back in
+//     batches of ALINKED_TWOLOCK_RETURN through one atomic pointer, which
+//     producers take whole before falling back to the arena.
+//   - `len_relaxed` subtracts two counters without locking; `len_exact` takes
+//     both locks, head first.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <pthread.h>
+#include <stdatomic.h>
+#include "alinked_queue.h"
+#include "alinked_wait.h"
+
+#ifndef ALINKED_TWOLOCK_RETURN
+#   define ALINKED_TWOLOCK_RETURN 32
+#endif
+
+#define DEFINE_ALINKED_TWOLOCK(V, NAME)                     \
+    typedef struct                                          \
+    {                                                       \
+        _Alignas(ALINKED_CACHE_LINE) pthread_mutex_t head_lock; \
+        alinked_node_##NAME##_t *head;                      \
+        alinked_node_##NAME##_t *retired;                   \
+        alinked_node_##NAME##_t *retired_last;              \
+        size_t retired_count;                               \
+        atomic_size_t popped;                               \
+        _Alignas(ALINKED_CACHE_LINE) pthread_mutex_t tail_lock; \
+        alinked_node_##NAME##_t *tail;                      \
+        alinked_node_##NAME##_t *spare;                     \
+        atomic_size_t pushed;                               \
+        alinked_queue_##NAME##_t pool;                      \
+        _Alignas(ALINKED_CACHE_LINE) alinked_node_##NAME##_t *returned; \
+    } alinked_twolock_##NAME##_t;                           \
+                                                            \
+    static inline void alinked_twolock_##NAME##_init(       \
+        alinked_twolock_##NAME##_t *queue,                  \
+        const size_t arena_len                              \
+    )                                                       \
+    {                                                       \
+        pthread_mutex_init(&queue->head_lock, NULL);        \
+        pthread_mutex_init(&queue->tail_lock, NULL);        \
+        alinked_queue_##NAME##_init(&queue->pool, arena_len); \
+        atomic_init(&queue->popped, 0);                     \
+        atomic_init(&queue->pushed, 0);                     \
+        queue->retired = NULL;                              \
+        queue->retired_last = NULL;                         \
+        queue->retired_count = 0;                           \
+        queue->spare = NULL;                                \
+        queue->returned = NULL;                             \
+        queue->head = NULL;                                 \
+        queue->tail = NULL;                                 \
+                                                            \
+        if (!queue->pool.allocator)                         \
+        {                                                   \
+            return;                                         \
+        }                                                   \
+                                                            \
+        alinked_node_##NAME##_t *dummy = __fluent_libc_##NAME##_linked_queue_suitable(&queue->pool); \
+        if (dummy)                                          \
+        {                                                   \
+            dummy->next = NULL;                             \
+            queue->head = dummy;                            \
+            queue->tail = dummy;                            \
+        }                                                   \
+    }                                                       \
+                                                            \
+    static inline void alinked_twolock_##NAME##_destroy(    \
+        alinked_twolock_##NAME##_t *queue                   \
+    )                                                       \
+    {                                                       \
+        alinked_queue_##NAME##_destroy(&queue->pool);       \
+        pthread_mutex_destroy(&queue->head_lock);           \
+        pthread_mutex_destroy(&queue->tail_lock);           \
+        queue->head = NULL;                                 \
+        queue->tail = NULL;                                 \
+        queue->retired = NULL;                              \
+        queue->retired_last = NULL;                         \
+        queue->retired_count = 0;                           \
+        queue->spare = NULL;                                \
+        queue->returned = NULL;                             \
+        atomic_store(&queue->popped, 0);                    \
+        atomic_store(&queue->pushed, 0);                    \
+    }                                                       \
+                                                            \
+    static inline alinked_node_##NAME##_t *__fluent_libc_##NAME##_twolock_node( \
+        alinked_twolock_##NAME##_t *queue                   \
+    )                                                       \
+    {                                                       \
+        if (!queue->spare)                                  \
+        {                                                   \
+            queue->spare = __atomic_exchange_n(&queue->returned, NULL, __ATOMIC_ACQUIRE); \
+        }                                                   \
+                                                            \
+        alinked_node_##NAME##_t *node = queue->spare;       \
+        if (!node)                                          \
+        {                                                   \
+            return __fluent_libc_##NAME##_linked_queue_suitable(&queue->pool); \
+        }                                                   \
+                                                            \
+        queue->spare = node->next;                          \
+        node->gen++;                                        \
+        queue->pool.reused++;                               \
+        return node;                                        \
+    }                                                       \
+                                                            \
+    static inline void __fluent_libc_##NAME##_twolock_retire( \
+        alinked_twolock_##NAME##_t *queue,                  \
+        alinked_node_##NAME##_t *node                       \
+    )                                                       \
+    {                                                       \
+        node->gen++;                                        \
+        node->next = queue->retired;                        \
+        if (!queue->retired)                                \
+        {                                                   \
+            queue->retired_last = node;                     \
+        }                                                   \
+                                                            \
+        queue->retired = node;                              \
+        if (++queue->retired_count < ALINKED_TWOLOCK_RETURN) \
+        {                                                   \
+            return;                                         \
+        }                                                   \
+                                                            \
+        alinked_node_##NAME##_t *top = __atomic_load_n(&queue->returned, __ATOMIC_RELAXED); \
+        do                                                  \
+        {                                                   \
+            queue->retired_last->next = top;                \
+        } while (!__atomic_compare_exchange_n(&queue->returned, &top, queue->retired, true, \
+            __ATOMIC_RELEASE, __ATOMIC_RELAXED));           \
+                                                            \
+        queue->retired = NULL;                              \
+        queue->retired_last = NULL;                         \
+        queue->retired_count = 0;                           \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_twolock_##NAME##_append_batch( \
+        alinked_twolock_##NAME##_t *queue,                  \
+        V const *items,                                     \
+        const size_t count                                  \
+    )                                                       \
+    {                                                       \
+        pthread_mutex_lock(&queue->tail_lock);              \
+        if (!queue->tail)                                   \
+        {                                                   \
+            pthread_mutex_unlock(&queue->tail_lock);        \
+            return 0;                                       \
+        }                                                   \
+                                                            \
+        size_t done = 0;                                    \
+        while (done < count)                                \
+        {                                                   \
+            alinked_node_##NAME##_t *node = __fluent_libc_##NAME##_twolock_node(queue); \
+            if (!node)                                      \
+            {                                               \
+                break;                                      \
+            }                                               \
+                                                            \
+            node->data = items[done++];                     \
+            node->next = NULL;                              \
+            __atomic_store_n(&queue->tail->next, node, __ATOMIC_RELEASE); \
+            queue->tail = node;                             \
+        }                                                   \
+                                                            \
+        atomic_store_explicit(&queue->pushed,               \
+            atomic_load_explicit(&queue->pushed, memory_order_relaxed) + done, \
+            memory_order_release);                          \
+        pthread_mutex_unlock(&queue->tail_lock);            \
+        return done;                                        \
+    }                                                       \
+                                                            \
+    static inline bool alinked_twolock_##NAME##_append(     \
+        alinked_twolock_##NAME##_t *queue,                  \
+        V data                                              \
+    )                                                       \
+    {                                                       \
+        return alinked_twolock_##NAME##_append_batch(queue, &data, 1) == 1; \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_twolock_##NAME##_shift_batch( \
+        alinked_twolock_##NAME##_t *queue,                  \
+        V *out,                                             \
+        const size_t max                                    \
+    )                                                       \
+    {                                                       \
+        pthread_mutex_lock(&queue->head_lock);              \
+        if (!queue->head)                                   \
+        {                                                   \
+            pthread_mutex_unlock(&queue->head_lock);        \
+            return 0;                                       \
+        }                                                   \
+                                                            \
+        size_t got = 0;                                     \
+        while (got < max)                                   \
+        {                                                   \
+            alinked_node_##NAME##_t *dummy = queue->head;   \
+            alinked_node_##NAME##_t *next = __atomic_load_n(&dummy->next, __ATOMIC_ACQUIRE); \
+            if (!next)                                      \
+            {                                               \
+                break;                                      \
+            }                                               \
+                                                            \
+            out[got++] = next->data;                        \
+            queue->head = next;                             \
+            __fluent_libc_##NAME##_twolock_retire(queue, dummy); \
+        }                                                   \
+                                                            \
+        atomic_store_explicit(&queue->popped,               \
+            atomic_load_explicit(&queue->popped, memory_order_relaxed) + got, \
+            memory_order_release);                          \
+        pthread_mutex_unlock(&queue->head_lock);            \
+        return got;                                         \
+    }                                                       \
+                                                            \
+    static inline bool alinked_twolock_##NAME##_try_shift(  \
+        alinked_twolock_##NAME##_t *queue,                  \
+        V *out                                              \
+    )                                                       \
+    {                                                       \
+        return alinked_twolock_##NAME##_shift_batch(queue, out, 1) == 1; \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_twolock_##NAME##_len_relaxed( \
+        alinked_twolock_##NAME##_t *queue                   \
+    )                                                       \
+    {                                                       \
+        const size_t popped = atomic_load_explicit(&queue->popped, memory_order_relaxed); \
+        const size_t pushed = atomic_load_explicit(&queue->pushed, memory_order_relaxed); \
+        return pushed > popped ? pushed - popped : 0;       \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_twolock_##NAME##_len_exact( \
+        alinked_twolock_##NAME##_t *queue                   \
+    )                                                       \
+    {                                                       \
+        pthread_mutex_lock(&queue->head_lock);              \
+        pthread_mutex_lock(&queue->tail_lock);              \
+        const size_t len = atomic_load(&queue->pushed) - atomic_load(&queue->popped); \
+        pthread_mutex_unlock(&queue->tail_lock);            \
+        pthread_mutex_unlock(&queue->head_lock);            \
+        return len;                                         \
+    }                                                       \
+                                                            \
+    static inline size_t alinked_twolock_##NAME##_len(      \
+        alinked_twolock_##NAME##_t *queue                   \
+    )                                                       \
+    {                                                       \
+        return alinked_twolock_##NAME##_len_relaxed(queue); \
+    }                                                       \
+                                                            \
+    static inline bool alinked_twolock_##NAME##_is_empty(   \
+        alinked_twolock_##NAME##_t *queue                   \
+    )                                                       \
+    {                                                       \
+        return alinked_twolock_##NAME##_len_relaxed(queue) == 0; \
+    }
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_TWOLOCK_LIBRARY_H
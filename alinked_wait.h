@@ -0,0 +1,343 @@
+/*
+ * This code is distributed under the terms of the GNU General Public License.
+ * For more information, please refer to the LICENSE file in the root directory.
+ * -------------------------------------------------
+ * Copyright (C) 2025 Rodrigo R.
+ * This program comes with ABSOLUTELY NO WARRANTY; for details type show w'.
+ * This is free software, and you are welcome to redistribute it
+ * under certain conditions; type show c' for details.
+*/
+
+#ifndef FLUENT_LIBC_A_LINKED_WAIT_LIBRARY_H
+#define FLUENT_LIBC_A_LINKED_WAIT_LIBRARY_H
+
+// ============= FLUENT LIB C =============
+// Consumer Wait Strategies
+// ----------------------------------------
+// Small set of idle strategies shared by the concurrent companions of the
+// arena-backed linked queue. A waiter calls `alinked_wait_idle` every time it
+// finds nothing to do and resets its spin counter once it makes progress.
+//
+// Strategies:
+//   • ALINKED_WAIT_SPIN    – pure busy-spin, lowest latency, burns a core.
+//   • ALINKED_WAIT_YIELD   – spin briefly, then give the core away.
+//   • ALINKED_WAIT_SLEEP   – spin, yield, then sleep in short naps.
+//   • ALINKED_WAIT_BACKOFF – exponential `pause` backoff, stays on the core.
+//   • ALINKED_WAIT_UMWAIT  – `umonitor`/`umwait` on the signal word where the
+//                            CPU has WAITPKG (detected at runtime), backoff
+//                            otherwise.
+//   • ALINKED_WAIT_PARK    – spin briefly, then sleep on the signal futex.
+//
+// `alinked_spinlock_t` is a test-and-set lock that backs off with YIELD, for
+// the short critical sections around shared node pools.
+//
+// UMWAIT and PARK need something to watch, so they only take full effect in
+// `alinked_wait_signal`; plain `alinked_wait_idle` treats them as SLEEP.
+//
+// Signals:
+//   `alinked_signal_t` is an epoch word waiters can park on (futex on Linux,
+//   short naps elsewhere). Producers bump the epoch on every empty → non-empty
+//   transition and wake one parked waiter, so sleepers never miss an update and
+//   never stampede.
+//
+// API Usage:
+// ----------------------------------------
+//   size_t spins = 0;
+//   while (!ready())
+//   {
+//       alinked_wait_idle(ALINKED_WAIT_YIELD, &spins);
+//   }
+//
+//   // blocking consumer
+//   spins = 0;
+//   for (;;)
+//   {
+//       unsigned epoch = alinked_signal_prepare(&signal);
+//       if (ready()) break;
+//       alinked_wait_signal(ALINKED_WAIT_PARK, &signal, epoch, &spins);
+//   }
+//
+// Notes:
+//   - Header-only, relies on C11 atomics and POSIX scheduling calls.
+//   - Every header defines _DEFAULT_SOURCE before its system includes, so
+//     syscall, clock_gettime and sigaction are declared under -std=c11; a
+//     translation unit that includes libc headers first must define it too.
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ============= INCLUDES =============
+#ifndef _DEFAULT_SOURCE
+#   define _DEFAULT_SOURCE
+#endif
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sched.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#   include <cpuid.h>
+#   include <x86intrin.h>
+#endif
+#if defined(__linux__)
+#   include <linux/futex.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#endif
+
+#ifndef ALINKED_CACHE_LINE
+#   define ALINKED_CACHE_LINE 64
+#endif
+
+#define ALINKED_WAIT_SPIN_LIMIT 128
+#define ALINKED_WAIT_YIELD_LIMIT 256
+#define ALINKED_WAIT_BACKOFF_SHIFT 10
+#define ALINKED_WAIT_UMWAIT_CYCLES 100000
+
+typedef enum
+{
+    ALINKED_WAIT_SPIN = 0,
+    ALINKED_WAIT_YIELD,
+    ALINKED_WAIT_SLEEP,
+    ALINKED_WAIT_BACKOFF,
+    ALINKED_WAIT_UMWAIT,
+    ALINKED_WAIT_PARK
+} alinked_wait_strategy_t;
+
+static inline void alinked_cpu_relax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+static inline void alinked_wait_idle(
+    const alinked_wait_strategy_t strategy,
+    size_t *spins
+)
+{
+    const size_t round = (*spins)++;
+
+    if (strategy == ALINKED_WAIT_BACKOFF)
+    {
+        const size_t shift = round < ALINKED_WAIT_BACKOFF_SHIFT ? round : ALINKED_WAIT_BACKOFF_SHIFT;
+        for (size_t i = 0; i < ((size_t)1 << shift); i++)
+        {
+            alinked_cpu_relax();
+        }
+
+        return;
+    }
+
+    if (strategy == ALINKED_WAIT_SPIN || round < ALINKED_WAIT_SPIN_LIMIT)
+    {
+        alinked_cpu_relax();
+        return;
+    }
+
+    if (strategy == ALINKED_WAIT_YIELD || round < ALINKED_WAIT_YIELD_LIMIT)
+    {
+        sched_yield();
+        return;
+    }
+
+    const struct timespec nap = { 0, 50000 };
+    nanosleep(&nap, NULL);
+}
+
+typedef struct
+{
+    _Alignas(ALINKED_CACHE_LINE) atomic_uint epoch;
+    atomic_uint sleepers;
+} alinked_signal_t;
+
+static inline uint64_t alinked_now_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+static inline void alinked_futex_wait(atomic_uint *word, const unsigned expected, const uint64_t timeout_ns)
+{
+#if defined(__linux__)
+    const struct timespec timeout = {
+        (time_t)(timeout_ns / 1000000000ull),
+        (long)(timeout_ns % 1000000000ull)
+    };
+    syscall(SYS_futex, (uint32_t *)word, FUTEX_WAIT_PRIVATE, expected, timeout_ns ? &timeout : NULL, NULL, 0);
+#else
+    (void)timeout_ns;
+    if (atomic_load(word) == expected)
+    {
+        const struct timespec nap = { 0, 50000 };
+        nanosleep(&nap, NULL);
+    }
+#endif
+}
+
+static inline void alinked_futex_wake(atomic_uint *word, const int count)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, (uint32_t *)word, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+#else
+    (void)word;
+    (void)count;
+#endif
+}
+
+static inline void alinked_signal_init(alinked_signal_t *signal)
+{
+    atomic_init(&signal->epoch, 0);
+    atomic_init(&signal->sleepers, 0);
+}
+
+static inline unsigned alinked_signal_prepare(alinked_signal_t *signal)
+{
+    return atomic_load(&signal->epoch);
+}
+
+static inline void alinked_signal_park_for(
+    alinked_signal_t *signal,
+    const unsigned epoch,
+    const uint64_t timeout_ns
+)
+{
+    atomic_fetch_add(&signal->sleepers, 1);
+    if (atomic_load(&signal->epoch) == epoch)
+    {
+        alinked_futex_wait(&signal->epoch, epoch, timeout_ns);
+    }
+
+    atomic_fetch_sub(&signal->sleepers, 1);
+}
+
+static inline void alinked_signal_park(alinked_signal_t *signal, const unsigned epoch)
+{
+    alinked_signal_park_for(signal, epoch, 0);
+}
+
+static inline void alinked_signal_notify(alinked_signal_t *signal)
+{
+    atomic_fetch_add(&signal->epoch, 1);
+    if (atomic_load(&signal->sleepers) > 0)
+    {
+        alinked_futex_wake(&signal->epoch, 1);
+    }
+}
+
+static inline void alinked_signal_broadcast(alinked_signal_t *signal)
+{
+    atomic_fetch_add(&signal->epoch, 1);
+    alinked_futex_wake(&signal->epoch, INT32_MAX);
+}
+
+typedef struct
+{
+    atomic_flag flag;
+} alinked_spinlock_t;
+
+static inline void alinked_spinlock_init(alinked_spinlock_t *lock)
+{
+    atomic_flag_clear(&lock->flag);
+}
+
+static inline bool alinked_spinlock_try_lock(alinked_spinlock_t *lock)
+{
+    return !atomic_flag_test_and_set_explicit(&lock->flag, memory_order_acquire);
+}
+
+static inline void alinked_spinlock_lock(alinked_spinlock_t *lock)
+{
+    size_t spins = 0;
+    while (!alinked_spinlock_try_lock(lock))
+    {
+        alinked_wait_idle(ALINKED_WAIT_YIELD, &spins);
+    }
+}
+
+static inline void alinked_spinlock_unlock(alinked_spinlock_t *lock)
+{
+    atomic_flag_clear_explicit(&lock->flag, memory_order_release);
+}
+
+static inline bool alinked_wait_has_umwait(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    static int detected = -1;
+    if (detected < 0)
+    {
+        unsigned eax, ebx, ecx = 0, edx;
+        detected = __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ecx & (1u << 5));
+    }
+
+    return detected == 1;
+#else
+    return false;
+#endif
+}
+
+static inline void alinked_wait_umwait(atomic_uint *word, const unsigned expected)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    const uint64_t deadline = __rdtsc() + ALINKED_WAIT_UMWAIT_CYCLES;
+
+    // umonitor %rax / umwait %ecx, spelled out for assemblers without WAITPKG
+    __asm__ __volatile__(".byte 0xf3, 0x0f, 0xae, 0xf0" :: "a"(word) : "memory");
+    if (atomic_load_explicit(word, memory_order_acquire) == expected)
+    {
+        __asm__ __volatile__(".byte 0xf2, 0x0f, 0xae, 0xf1"
+            :: "c"(0), "a"((uint32_t)deadline), "d"((uint32_t)(deadline >> 32)) : "memory", "cc");
+    }
+#else
+    (void)word;
+    (void)expected;
+#endif
+}
+
+static inline void alinked_wait_signal(
+    const alinked_wait_strategy_t strategy,
+    alinked_signal_t *signal,
+    const unsigned epoch,
+    size_t *spins
+)
+{
+    if (strategy == ALINKED_WAIT_UMWAIT)
+    {
+        if (alinked_wait_has_umwait())
+        {
+            alinked_wait_umwait(&signal->epoch, epoch);
+            return;
+        }
+
+        alinked_wait_idle(ALINKED_WAIT_BACKOFF, spins);
+        return;
+    }
+
+    if (strategy == ALINKED_WAIT_PARK)
+    {
+        if ((*spins)++ < ALINKED_WAIT_SPIN_LIMIT)
+        {
+            alinked_cpu_relax();
+            return;
+        }
+
+        alinked_signal_park(signal, epoch);
+        return;
+    }
+
+    alinked_wait_idle(strategy, spins);
+}
+
+// ============= FLUENT LIB C++ =============
+#if defined(__cplusplus)
+}
+#endif
+
+#endif //FLUENT_LIBC_A_LINKED_WAIT_LIBRARY_H